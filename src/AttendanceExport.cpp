@@ -0,0 +1,351 @@
+#include "AttendanceExport.h"
+
+#include "AttendanceLog.h"
+#include "Utils.h"
+#include "Xlsx.h"
+
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QSaveFile>
+#include <QThread>
+
+#include <algorithm>
+#include <memory>
+
+namespace {
+constexpr int kFlushBytes = 64 * 1024;
+const char* const kWeekdays[] = {"周一", "周二", "周三", "周四", "周五", "周六", "周日"};
+
+struct ExportRow {
+    QDate date;
+    QString className;
+    QStringList absentees;
+};
+
+// 输出端：行先拼进缓冲区，攒够一块再写文件。
+class ExportSink {
+public:
+    explicit ExportSink(QSaveFile& out) : m_out(out) {}
+    virtual ~ExportSink() = default;
+    virtual bool begin() = 0;
+    virtual bool row(const ExportRow& row) = 0;
+    virtual bool finish() = 0;
+
+protected:
+    bool put(const QByteArray& data) {
+        m_buffer.append(data);
+        return m_buffer.size() < kFlushBytes || flushBuffer();
+    }
+    bool flushBuffer() {
+        if (m_buffer.isEmpty()) return true;
+        const bool ok = writeChunk(m_buffer);
+        m_buffer.clear();
+        return ok;
+    }
+    virtual bool writeChunk(const QByteArray& data) { return m_out.write(data) == data.size(); }
+
+    QSaveFile& m_out;
+    QByteArray m_buffer;
+};
+
+QByteArray csvField(const QString& text) {
+    QByteArray utf8 = text.toUtf8();
+    if (utf8.contains(',') || utf8.contains('"') || utf8.contains('\n') || utf8.contains('\r')) {
+        utf8.replace("\"", "\"\"");
+        utf8.prepend('"');
+        utf8.append('"');
+    }
+    return utf8;
+}
+
+class CsvSink : public ExportSink {
+public:
+    using ExportSink::ExportSink;
+
+    bool begin() override {
+        // 带 BOM，Excel 直接打开时才能正确识别中文。
+        return put("\xEF\xBB\xBF日期,星期,班级,缺勤人数,缺勤名单\r\n");
+    }
+    bool row(const ExportRow& row) override {
+        QByteArray line;
+        line += row.date.toString(Qt::ISODate).toUtf8() + ',';
+        line += QByteArray(kWeekdays[row.date.dayOfWeek() - 1]) + ',';
+        line += csvField(row.className) + ',';
+        line += QByteArray::number(row.absentees.size()) + ',';
+        line += csvField(row.absentees.join("、")) + "\r\n";
+        return put(line);
+    }
+    bool finish() override { return flushBuffer(); }
+};
+
+QByteArray xmlText(const QString& text) {
+    QByteArray out;
+    out.reserve(text.size() * 3);
+    for (const QChar ch : text) {
+        const ushort u = ch.unicode();
+        if (u < 0x20 && u != '\t' && u != '\n' && u != '\r') continue;  // XML 1.0 不允许的控制字符
+        switch (u) {
+        case '&': out += "&amp;"; break;
+        case '<': out += "&lt;"; break;
+        case '>': out += "&gt;"; break;
+        default: out += QString(ch).toUtf8(); break;
+        }
+    }
+    return out;
+}
+
+// 最小 ZIP 写出器：条目均为存储方式，写完数据后回填本地头里的 CRC 与长度。
+class ZipWriter {
+public:
+    explicit ZipWriter(QSaveFile& out) : m_out(out) {}
+
+    bool beginEntry(const QByteArray& name) {
+        m_current = {name, m_out.pos(), 0, 0};
+        QByteArray header;
+        appendU32(header, 0x04034B50);
+        appendU16(header, 20);
+        appendU16(header, 0);
+        appendU16(header, 0);  // 存储
+        appendU16(header, m_dosTime);
+        appendU16(header, m_dosDate);
+        appendU32(header, 0);
+        appendU32(header, 0);
+        appendU32(header, 0);
+        appendU16(header, quint16(name.size()));
+        appendU16(header, 0);
+        header += name;
+        return m_out.write(header) == header.size();
+    }
+    bool write(const QByteArray& data) {
+        m_current.crc = Xlsx::crc32(m_current.crc, data.constData(), data.size());
+        m_current.size += data.size();
+        return m_out.write(data) == data.size();
+    }
+    bool endEntry() {
+        const qint64 end = m_out.pos();
+        if (end > 0xFFFFFFFFll) return false;  // 不写 ZIP64，一学年的考勤远小于 4GB
+        QByteArray fields;
+        appendU32(fields, m_current.crc);
+        appendU32(fields, quint32(m_current.size));
+        appendU32(fields, quint32(m_current.size));
+        if (!m_out.seek(m_current.offset + 14) || m_out.write(fields) != fields.size() || !m_out.seek(end)) return false;
+        m_entries.append(m_current);
+        return true;
+    }
+    bool entry(const QByteArray& name, const QByteArray& data) {
+        return beginEntry(name) && write(data) && endEntry();
+    }
+    bool finish() {
+        const qint64 directoryOffset = m_out.pos();
+        QByteArray directory;
+        for (const Entry& e : m_entries) {
+            appendU32(directory, 0x02014B50);
+            appendU16(directory, 20);
+            appendU16(directory, 20);
+            appendU16(directory, 0);
+            appendU16(directory, 0);
+            appendU16(directory, m_dosTime);
+            appendU16(directory, m_dosDate);
+            appendU32(directory, e.crc);
+            appendU32(directory, quint32(e.size));
+            appendU32(directory, quint32(e.size));
+            appendU16(directory, quint16(e.name.size()));
+            appendU16(directory, 0);
+            appendU16(directory, 0);
+            appendU16(directory, 0);
+            appendU16(directory, 0);
+            appendU32(directory, 0);
+            appendU32(directory, quint32(e.offset));
+            directory += e.name;
+        }
+        const quint32 directorySize = quint32(directory.size());
+        appendU32(directory, 0x06054B50);
+        appendU16(directory, 0);
+        appendU16(directory, 0);
+        appendU16(directory, quint16(m_entries.size()));
+        appendU16(directory, quint16(m_entries.size()));
+        appendU32(directory, directorySize);
+        appendU32(directory, quint32(directoryOffset));
+        appendU16(directory, 0);
+        return m_out.write(directory) == directory.size();
+    }
+
+private:
+    struct Entry {
+        QByteArray name;
+        qint64 offset;
+        quint32 crc;
+        qint64 size;
+    };
+
+    static void appendU16(QByteArray& out, quint16 v) {
+        out.append(char(v & 0xFF));
+        out.append(char(v >> 8));
+    }
+    static void appendU32(QByteArray& out, quint32 v) {
+        for (int i = 0; i < 4; ++i) out.append(char((v >> (8 * i)) & 0xFF));
+    }
+
+    QSaveFile& m_out;
+    QVector<Entry> m_entries;
+    Entry m_current{};
+    quint16 m_dosTime = 0;
+    quint16 m_dosDate = 0x21;  // 1980-01-01
+};
+
+class XlsxSink : public ExportSink {
+public:
+    explicit XlsxSink(QSaveFile& out) : ExportSink(out), m_zip(out) {}
+
+    bool begin() override {
+        const QByteArray xmlHeader = "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n";
+        const bool ok = m_zip.entry("[Content_Types].xml", xmlHeader +
+            "<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/content-types\">"
+            "<Default Extension=\"rels\" ContentType=\"application/vnd.openxmlformats-package.relationships+xml\"/>"
+            "<Default Extension=\"xml\" ContentType=\"application/xml\"/>"
+            "<Override PartName=\"/xl/workbook.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet.main+xml\"/>"
+            "<Override PartName=\"/xl/worksheets/sheet1.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml\"/>"
+            "</Types>")
+            && m_zip.entry("_rels/.rels", xmlHeader +
+            "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+            "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/officeDocument\" Target=\"xl/workbook.xml\"/>"
+            "</Relationships>")
+            && m_zip.entry("xl/workbook.xml", xmlHeader +
+            "<workbook xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\" "
+            "xmlns:r=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships\">"
+            "<sheets><sheet name=\"考勤\" sheetId=\"1\" r:id=\"rId1\"/></sheets></workbook>")
+            && m_zip.entry("xl/_rels/workbook.xml.rels", xmlHeader +
+            "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+            "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet\" Target=\"worksheets/sheet1.xml\"/>"
+            "</Relationships>");
+        if (!ok || !m_zip.beginEntry("xl/worksheets/sheet1.xml")) return false;
+        return put(xmlHeader + "<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\"><sheetData>")
+            && put(textRow({"日期", "星期", "班级", "缺勤人数", "缺勤名单"}));
+    }
+    bool row(const ExportRow& row) override {
+        QByteArray xml = "<row>";
+        xml += textCell(row.date.toString(Qt::ISODate));
+        xml += textCell(QString::fromUtf8(kWeekdays[row.date.dayOfWeek() - 1]));
+        xml += textCell(row.className);
+        xml += "<c><v>" + QByteArray::number(row.absentees.size()) + "</v></c>";
+        xml += textCell(row.absentees.join("、"));
+        xml += "</row>";
+        return put(xml);
+    }
+    bool finish() override {
+        return put("</sheetData></worksheet>") && flushBuffer() && m_zip.endEntry() && m_zip.finish();
+    }
+
+protected:
+    // 工作表数据分块写入 ZIP 条目，同时累计 CRC。
+    bool writeChunk(const QByteArray& data) override { return m_zip.write(data); }
+
+private:
+    static QByteArray textCell(const QString& text) {
+        return "<c t=\"inlineStr\"><is><t xml:space=\"preserve\">" + xmlText(text) + "</t></is></c>";
+    }
+    static QByteArray textRow(const QStringList& cells) {
+        QByteArray xml = "<row>";
+        for (const QString& cell : cells) xml += textCell(cell);
+        return xml + "</row>";
+    }
+
+    ZipWriter m_zip;
+};
+}  // namespace
+
+AttendanceExporter::AttendanceExporter(QObject* parent) : QObject(parent) {}
+
+AttendanceExporter::~AttendanceExporter() {
+    if (m_worker) {
+        m_cancel = true;
+        m_worker->wait();
+        delete m_worker;
+    }
+}
+
+bool AttendanceExporter::start(const AttendanceExportRequest& request) {
+    if (m_worker) return false;
+
+    // 偏移在 UI 线程一次取齐；记录只追加不改写，工作线程读取期间仍然有效。
+    const AttendanceLog& log = AttendanceLog::instance();
+    m_request = request;
+    m_entries.clear();
+    for (int i = 0; i < request.classes.size(); ++i) {
+        const QString& classKey = request.classes.at(i).id;
+        const QVector<QDate> days = log.recordedDays(classKey, request.from, request.to);
+        const QVector<qint64> offsets = log.recordOffsets(classKey, request.from, request.to);
+        for (int d = 0; d < days.size(); ++d) m_entries.append({int(days.at(d).toJulianDay()), i, offsets.at(d)});
+    }
+    std::sort(m_entries.begin(), m_entries.end(), [](const Entry& a, const Entry& b) {
+        return a.day != b.day ? a.day < b.day : a.classIndex < b.classIndex;
+    });
+    m_logPath = log.path();
+    m_cancel = false;
+    m_ok = false;
+    m_message.clear();
+
+    m_worker = QThread::create([this]() { run(); });
+    m_worker->setObjectName("AttendanceExport");
+    connect(m_worker, &QThread::finished, this, &AttendanceExporter::finishRun);
+    m_worker->start(QThread::LowPriority);
+    return true;
+}
+
+void AttendanceExporter::cancel() {
+    m_cancel = true;
+}
+
+void AttendanceExporter::run() {
+    QElapsedTimer timer;
+    timer.start();
+    QFile log(m_logPath);
+    QSaveFile out(m_request.path);
+    if (!log.open(QIODevice::ReadOnly) || !out.open(QIODevice::WriteOnly)) {
+        m_message = QString("无法打开文件：%1").arg(log.isOpen() ? out.errorString() : log.errorString());
+        return;
+    }
+
+    std::unique_ptr<ExportSink> sink;
+    if (m_request.format == AttendanceExportRequest::Xlsx) sink = std::make_unique<XlsxSink>(out);
+    else sink = std::make_unique<CsvSink>(out);
+
+    bool ok = sink->begin();
+    const int total = m_entries.size();
+    int reported = -1;
+    AttendanceLog::Record record;
+    for (int i = 0; ok && i < total; ++i) {
+        if (m_cancel) {
+            out.cancelWriting();
+            m_message = "导出已取消";
+            return;
+        }
+        const Entry& entry = m_entries.at(i);
+        if (!AttendanceLog::readRecord(log, entry.offset, &record)) continue;
+        ok = sink->row({QDate::fromJulianDay(record.day), m_request.classes.at(entry.classIndex).name, record.absentees});
+
+        // 进度按百分比节流，避免大量排队信号拖慢 UI。
+        const int percent = int(qint64(i + 1) * 100 / total);
+        if (percent != reported) {
+            reported = percent;
+            emit progress(i + 1, total);
+        }
+    }
+    ok = ok && sink->finish();
+    if (!ok || !out.commit()) {
+        m_message = QString("写入失败：%1").arg(out.errorString());
+        return;
+    }
+    m_ok = true;
+    m_message = QString("已导出 %1 条考勤记录").arg(total);
+    Logger::instance().info(QString("考勤导出：%1 条记录，耗时 %2 ms").arg(total).arg(timer.elapsed()));
+}
+
+void AttendanceExporter::finishRun() {
+    m_worker->deleteLater();
+    m_worker = nullptr;
+    m_entries.clear();
+    m_entries.squeeze();
+    emit finished(m_ok, m_message);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <QDate>
+#include <QObject>
+#include <QString>
+#include <QVector>
+
+#include <atomic>
+
+#include "ClassStore.h"
+
+class QThread;
+
+struct AttendanceExportRequest {
+    enum Format { Csv, Xlsx };
+
+    QString path;
+    Format format = Csv;
+    QDate from;
+    QDate to;
+    QVector<ClassInfo> classes;  // id 为空表示默认班级
+};
+
+// 考勤导出：在 UI 线程只取出各班级记录的偏移，工作线程用独立句柄逐条读取并流式写出，
+// 内存占用与导出范围无关。XLSX 为手写的最小工作簿（内联字符串、ZIP 存储方式）。
+class AttendanceExporter : public QObject {
+    Q_OBJECT
+public:
+    explicit AttendanceExporter(QObject* parent = nullptr);
+    ~AttendanceExporter() override;
+
+    bool start(const AttendanceExportRequest& request);
+    void cancel();
+    bool isRunning() const { return m_worker != nullptr; }
+
+signals:
+    void progress(int done, int total);
+    void finished(bool ok, const QString& message);
+
+private:
+    struct Entry {
+        int day;
+        int classIndex;
+        qint64 offset;
+    };
+
+    void run();
+    void finishRun();
+
+    AttendanceExportRequest m_request;
+    QVector<Entry> m_entries;
+    QString m_logPath;
+    QThread* m_worker = nullptr;
+    std::atomic_bool m_cancel{false};
+
+    // 仅由工作线程写入，线程结束后才在 UI 线程读取。
+    bool m_ok = false;
+    QString m_message;
+};
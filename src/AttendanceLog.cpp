@@ -0,0 +1,296 @@
+#include "AttendanceLog.h"
+
+#include "Utils.h"
+#include "Xlsx.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QStandardPaths>
+
+#include <algorithm>
+
+#ifdef Q_OS_WIN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr quint32 kRecordMagic = 0x52414643;  // "CFAR"
+constexpr int kHeaderSize = 12;              // magic + 负载长度 + CRC
+
+quint16 readU16(const uchar* p) {
+    return quint16(p[0] | (p[1] << 8));
+}
+
+quint32 readU32(const uchar* p) {
+    return quint32(p[0]) | (quint32(p[1]) << 8) | (quint32(p[2]) << 16) | (quint32(p[3]) << 24);
+}
+
+void writeU16(QByteArray& out, quint16 v) {
+    out.append(char(v & 0xFF));
+    out.append(char(v >> 8));
+}
+
+void writeU32(QByteArray& out, quint32 v) {
+    for (int i = 0; i < 4; ++i) out.append(char((v >> (8 * i)) & 0xFF));
+}
+
+void writeText(QByteArray& out, const QString& text) {
+    const QByteArray utf8 = text.toUtf8().left(0xFFFF);
+    writeU16(out, quint16(utf8.size()));
+    out.append(utf8);
+}
+
+// 负载：日期（儒略日）、保存时间、班级、缺勤人数及姓名，均为小端序。
+QByteArray encodePayload(const QString& classKey, int day, const QStringList& absentees) {
+    QByteArray payload;
+    writeU32(payload, quint32(day));
+    const quint64 savedAt = quint64(QDateTime::currentMSecsSinceEpoch());
+    writeU32(payload, quint32(savedAt & 0xFFFFFFFFu));
+    writeU32(payload, quint32(savedAt >> 32));
+    writeText(payload, classKey);
+    writeU16(payload, quint16(qMin(absentees.size(), 0xFFFF)));
+    for (int i = 0; i < absentees.size() && i < 0xFFFF; ++i) {
+        writeText(payload, absentees.at(i));
+    }
+    return payload;
+}
+
+bool decodePayload(const uchar* p, qint64 size, QString* classKey, int* day, QStringList* absentees) {
+    const uchar* end = p + size;
+    const auto readText = [&](QString* out) {
+        if (end - p < 2) return false;
+        const int len = readU16(p);
+        p += 2;
+        if (end - p < len) return false;
+        if (out) *out = QString::fromUtf8(reinterpret_cast<const char*>(p), len);
+        p += len;
+        return true;
+    };
+
+    if (size < 12) return false;
+    *day = int(readU32(p));
+    p += 12;
+    if (!readText(classKey) || end - p < 2) return false;
+    const int count = readU16(p);
+    p += 2;
+    if (absentees) {
+        absentees->clear();
+        absentees->reserve(count);
+    }
+    for (int i = 0; i < count; ++i) {
+        QString name;
+        if (!readText(absentees ? &name : nullptr)) return false;
+        if (absentees) absentees->append(name);
+    }
+    return true;
+}
+
+bool syncToDisk(QFile& file) {
+    if (!file.flush()) return false;
+#ifdef Q_OS_WIN
+    return FlushFileBuffers(reinterpret_cast<HANDLE>(_get_osfhandle(file.handle()))) != 0;
+#else
+    return ::fsync(file.handle()) == 0;
+#endif
+}
+}  // namespace
+
+AttendanceLog& AttendanceLog::instance() {
+    static AttendanceLog log;
+    return log;
+}
+
+AttendanceLog::AttendanceLog() {
+    const QString dataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(dataPath);
+    m_path = dataPath + "/attendance.log";
+    m_file.setFileName(m_path);
+    load();
+}
+
+void AttendanceLog::load() {
+    if (!m_file.open(QIODevice::ReadWrite)) {
+        Logger::instance().warn(QString("考勤记录打开失败：%1").arg(m_file.errorString()));
+        return;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    const qint64 size = m_file.size();
+    uchar* data = size > 0 ? m_file.map(0, size) : nullptr;
+    QByteArray fallback;
+    if (!data && size > 0) {
+        fallback = m_file.readAll();
+        data = reinterpret_cast<uchar*>(fallback.data());
+    }
+
+    // 偏移处是一条完整记录时返回负载长度，否则返回 -1。
+    const auto recordAt = [&](qint64 at, QString* classKey, int* day) -> qint64 {
+        const uchar* h = data + at;
+        if (readU32(h) != kRecordMagic) return -1;
+        const qint64 length = readU32(h + 4);
+        if (at + kHeaderSize + length > size
+            || Xlsx::crc32(0, reinterpret_cast<const char*>(h + kHeaderSize), length) != readU32(h + 8)
+            || !decodePayload(h + kHeaderSize, length, classKey, day, nullptr)) {
+            return -1;
+        }
+        return length;
+    };
+
+    // 第一遍只记录每个班级每天最后一条记录的偏移。
+    // 中间某条记录损坏时向后找到下一条完整记录继续，只有其后再没有完整记录才视为残缺尾部。
+    qint64 offset = 0;
+    qint64 end = 0;
+    qint64 skipped = 0;
+    int records = 0;
+    while (offset + kHeaderSize <= size) {
+        QString classKey;
+        int day = 0;
+        const qint64 length = recordAt(offset, &classKey, &day);
+        if (length < 0) {
+            qint64 next = offset + 1;
+            while (next + kHeaderSize <= size && recordAt(next, &classKey, &day) < 0) ++next;
+            if (next + kHeaderSize > size) break;
+            skipped += next - offset;
+            offset = next;
+            continue;
+        }
+        m_classes[classKey].dayOffsets.insert(day, offset);
+        offset += kHeaderSize + length;
+        end = offset;
+        ++records;
+    }
+
+    // 第二遍只解码生效的记录，按日期升序建立学生倒排表。
+    for (auto it = m_classes.begin(); it != m_classes.end(); ++it) {
+        ClassIndex& index = it.value();
+        for (auto day = index.dayOffsets.cbegin(); day != index.dayOffsets.cend(); ++day) {
+            const uchar* h = data + day.value();
+            QString classKey;
+            int d = 0;
+            QStringList absentees;
+            decodePayload(h + kHeaderSize, readU32(h + 4), &classKey, &d, &absentees);
+            for (const QString& name : absentees) index.studentDays[name].append(d);
+        }
+    }
+
+    if (data && fallback.isEmpty()) m_file.unmap(data);
+    if (skipped > 0) {
+        Logger::instance().warn(QString("考勤记录中有 %1 字节损坏，已跳过，之后的记录照常读取").arg(skipped));
+    }
+    if (end < size) {
+        Logger::instance().warn(QString("考勤记录尾部 %1 字节不完整，已截断").arg(size - end));
+        m_file.resize(end);
+    }
+    m_size = end;
+    Logger::instance().info(QString("考勤记录加载：%1 条，%2 个班级，耗时 %3 ms")
+                                .arg(records)
+                                .arg(m_classes.size())
+                                .arg(timer.nsecsElapsed() / 1e6, 0, 'f', 2));
+}
+
+bool AttendanceLog::readRecord(QFile& file, qint64 offset, Record* record) {
+    if (!file.isOpen() || !file.seek(offset)) return false;
+    const QByteArray header = file.read(kHeaderSize);
+    if (header.size() != kHeaderSize) return false;
+    const auto* h = reinterpret_cast<const uchar*>(header.constData());
+    if (readU32(h) != kRecordMagic) return false;
+    const QByteArray payload = file.read(readU32(h + 4));
+    if (Xlsx::crc32(0, payload.constData(), payload.size()) != readU32(h + 8)) return false;
+    return decodePayload(reinterpret_cast<const uchar*>(payload.constData()), payload.size(), &record->classKey, &record->day,
+                         &record->absentees);
+}
+
+void AttendanceLog::indexRecord(ClassIndex& index, int day, const QStringList& absentees) {
+    for (const QString& name : absentees) {
+        QVector<int>& days = index.studentDays[name];
+        const auto pos = std::lower_bound(days.begin(), days.end(), day);
+        if (pos == days.end() || *pos != day) days.insert(pos, day);
+    }
+}
+
+bool AttendanceLog::append(const QString& classKey, const QDate& date, const QStringList& absentees) {
+    if (!m_file.isOpen() || !date.isValid()) return false;
+    const int day = int(date.toJulianDay());
+    const QByteArray payload = encodePayload(classKey, day, absentees);
+    QByteArray record;
+    record.reserve(kHeaderSize + payload.size());
+    writeU32(record, kRecordMagic);
+    writeU32(record, quint32(payload.size()));
+    writeU32(record, Xlsx::crc32(0, payload.constData(), payload.size()));
+    record.append(payload);
+
+    if (!m_file.seek(m_size) || m_file.write(record) != record.size() || !syncToDisk(m_file)) {
+        Logger::instance().warn(QString("考勤记录写入失败：%1").arg(m_file.errorString()));
+        m_file.resize(m_size);
+        return false;
+    }
+
+    ClassIndex& index = m_classes[classKey];
+    const auto previous = index.dayOffsets.constFind(day);
+    Record old;
+    if (previous != index.dayOffsets.constEnd() && readRecord(m_file, previous.value(), &old)) {
+        for (const QString& name : old.absentees) {
+            QVector<int>& days = index.studentDays[name];
+            days.erase(std::remove(days.begin(), days.end(), day), days.end());
+        }
+    }
+    index.dayOffsets.insert(day, m_size);
+    indexRecord(index, day, absentees);
+    m_size += record.size();
+    return true;
+}
+
+QStringList AttendanceLog::absentees(const QString& classKey, const QDate& date) const {
+    const auto it = m_classes.constFind(classKey);
+    if (it == m_classes.constEnd()) return {};
+    const auto day = it->dayOffsets.constFind(int(date.toJulianDay()));
+    Record record;
+    if (day == it->dayOffsets.constEnd() || !readRecord(m_file, day.value(), &record)) return {};
+    return record.absentees;
+}
+
+QVector<QDate> AttendanceLog::absences(const QString& classKey, const QString& studentKey, const QDate& from,
+                                       const QDate& to) const {
+    QVector<QDate> out;
+    const auto it = m_classes.constFind(classKey);
+    if (it == m_classes.constEnd()) return out;
+    const QVector<int> days = it->studentDays.value(studentKey);
+    auto pos = std::lower_bound(days.cbegin(), days.cend(), int(from.toJulianDay()));
+    for (const int last = int(to.toJulianDay()); pos != days.cend() && *pos <= last; ++pos) {
+        out.append(QDate::fromJulianDay(*pos));
+    }
+    return out;
+}
+
+QVector<QDate> AttendanceLog::recordedDays(const QString& classKey, const QDate& from, const QDate& to) const {
+    QVector<QDate> out;
+    const auto it = m_classes.constFind(classKey);
+    if (it == m_classes.constEnd()) return out;
+    const int last = int(to.toJulianDay());
+    for (auto day = it->dayOffsets.lowerBound(int(from.toJulianDay())); day != it->dayOffsets.cend() && day.key() <= last; ++day) {
+        out.append(QDate::fromJulianDay(day.key()));
+    }
+    return out;
+}
+
+QVector<qint64> AttendanceLog::recordOffsets(const QString& classKey, const QDate& from, const QDate& to) const {
+    QVector<qint64> out;
+    const auto it = m_classes.constFind(classKey);
+    if (it == m_classes.constEnd()) return out;
+    const int last = int(to.toJulianDay());
+    for (auto day = it->dayOffsets.lowerBound(int(from.toJulianDay())); day != it->dayOffsets.cend() && day.key() <= last; ++day) {
+        out.append(day.value());
+    }
+    return out;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QDate>
+#include <QFile>
+#include <QHash>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// 考勤历史：每次保存追加一条带 CRC 的紧凑记录并立即落盘，从不改写旧记录。
+// 启动时顺序扫描一次，为每个班级建立“日期 → 记录偏移”和“学生 → 缺勤日期”两个索引；
+// 同一天多次保存以最后一条为准。文件尾部不完整的记录（写入时断电）会被截掉，
+// 中间损坏的字节只跳过，不影响其后的记录。
+class AttendanceLog {
+public:
+    struct Record {
+        QString classKey;
+        int day = 0;
+        QStringList absentees;
+    };
+
+    static AttendanceLog& instance();
+    // 记录写入后不再改动，偏移可以交给工作线程用自己的文件句柄读取。
+    static bool readRecord(QFile& file, qint64 offset, Record* record);
+
+    bool append(const QString& classKey, const QDate& date, const QStringList& absentees);
+    QStringList absentees(const QString& classKey, const QDate& date) const;
+    // studentKey 见 Roster::keys。
+    QVector<QDate> absences(const QString& classKey, const QString& studentKey, const QDate& from, const QDate& to) const;
+    QVector<QDate> recordedDays(const QString& classKey, const QDate& from, const QDate& to) const;
+    QVector<qint64> recordOffsets(const QString& classKey, const QDate& from, const QDate& to) const;
+    QString path() const { return m_path; }
+
+private:
+    struct ClassIndex {
+        QMap<int, qint64> dayOffsets;
+        QHash<QString, QVector<int>> studentDays;  // 日期按升序排列
+    };
+    AttendanceLog();
+    void load();
+    void indexRecord(ClassIndex& index, int day, const QStringList& absentees);
+
+    QString m_path;
+    mutable QFile m_file;
+    qint64 m_size = 0;
+    QHash<QString, ClassIndex> m_classes;
+};
@@ -0,0 +1,176 @@
+#include "AttendanceStats.h"
+
+#include "AttendanceLog.h"
+#include "Random.h"
+#include "Utils.h"
+
+#include <QElapsedTimer>
+
+#include <algorithm>
+
+void AttendanceMatrix::load(const QString& classKey, const RosterPtr& roster, const QDate& from, const QDate& to) {
+    QElapsedTimer timer;
+    timer.start();
+    reset(classKey, roster, from, to);
+
+    const AttendanceLog& log = AttendanceLog::instance();
+    const QVector<QDate> days = log.recordedDays(classKey, from, to);
+    const QHash<QString, StudentId> keys = roster->keyIndex();
+    m_days.reserve(days.size());
+    m_columns.reserve(days.size());
+    m_columnAbsent.reserve(days.size());
+    for (const QDate& day : days) {
+        m_days.append(int(day.toJulianDay()));
+        m_columns.append(roster->setOf(log.absentees(classKey, day), keys));
+        m_columnAbsent.append(0);
+        accumulate(m_columns.size() - 1, 1);
+    }
+    Logger::instance().info(QString("考勤统计加载：%1 名学生 × %2 天，耗时 %3 ms")
+                                .arg(roster->size())
+                                .arg(m_days.size())
+                                .arg(timer.nsecsElapsed() / 1e6, 0, 'f', 2));
+}
+
+void AttendanceMatrix::reset(const QString& classKey, const RosterPtr& roster, const QDate& from, const QDate& to) {
+    m_classKey = classKey;
+    m_roster = roster;
+    m_from = from;
+    m_to = to;
+    m_days.clear();
+    m_columns.clear();
+    m_columnAbsent.clear();
+    m_absences = QVector<int>(roster->size(), 0);
+    m_weekdayAbsences = QVector<int>(roster->size() * 7, 0);
+    m_weekdayDays.fill(0);
+    m_weekdayAbsent.fill(0);
+}
+
+void AttendanceMatrix::setDay(const QDate& date, const StudentSet& absentees) {
+    if (!m_roster || absentees.size() != m_roster->size() || date < m_from || date > m_to) return;
+    const int day = int(date.toJulianDay());
+    const auto pos = std::lower_bound(m_days.begin(), m_days.end(), day);
+    const int column = int(pos - m_days.begin());
+    if (pos != m_days.end() && *pos == day) {
+        accumulate(column, -1);
+        m_columns[column] = absentees;
+    } else {
+        m_days.insert(column, day);
+        m_columns.insert(column, absentees);
+        m_columnAbsent.insert(column, 0);
+    }
+    accumulate(column, 1);
+}
+
+void AttendanceMatrix::accumulate(int column, int sign) {
+    const StudentSet& set = m_columns.at(column);
+    int absent = 0;
+    for (const quint64 word : set.words()) absent += qPopulationCount(word);
+
+    const int weekday = QDate::fromJulianDay(m_days.at(column)).dayOfWeek() - 1;
+    m_columnAbsent[column] = sign > 0 ? absent : 0;
+    m_weekdayDays[weekday] += sign;
+    m_weekdayAbsent[weekday] += sign * absent;
+    set.forEach([&](StudentId id) {
+        m_absences[id] += sign;
+        m_weekdayAbsences[id * 7 + weekday] += sign;
+    });
+}
+
+int AttendanceMatrix::totalAbsences() const {
+    int total = 0;
+    for (const int n : m_columnAbsent) total += n;
+    return total;
+}
+
+double AttendanceMatrix::attendanceRate(StudentId id) const {
+    if (m_days.isEmpty()) return 1.0;
+    return 1.0 - double(m_absences.at(id)) / m_days.size();
+}
+
+QVector<StudentAttendance> AttendanceMatrix::report() const {
+    QElapsedTimer timer;
+    timer.start();
+    const int size = m_roster ? m_roster->size() : 0;
+    QVector<StudentAttendance> out(size);
+    QVector<int> lastColumn(size, -2);
+    for (StudentId id = 0; id < size; ++id) {
+        StudentAttendance& row = out[id];
+        row.id = id;
+        row.absences = m_absences.at(id);
+        std::copy_n(m_weekdayAbsences.constData() + id * 7, 7, row.weekdayAbsences.begin());
+    }
+
+    // 连续缺勤按记录日计算（周末、假期不记录即不打断），只遍历置位的位。
+    for (int column = 0; column < m_columns.size(); ++column) {
+        m_columns.at(column).forEach([&](StudentId id) {
+            StudentAttendance& row = out[id];
+            row.currentStreak = lastColumn.at(id) == column - 1 ? row.currentStreak + 1 : 1;
+            row.longestStreak = qMax(row.longestStreak, row.currentStreak);
+            lastColumn[id] = column;
+        });
+    }
+    for (StudentId id = 0; id < size; ++id) {
+        if (lastColumn.at(id) != m_columns.size() - 1) out[id].currentStreak = 0;
+    }
+
+    Logger::instance().info(QString("考勤统计报表：%1 名学生 × %2 天，耗时 %3 ms")
+                                .arg(size)
+                                .arg(m_columns.size())
+                                .arg(timer.nsecsElapsed() / 1e6, 0, 'f', 3));
+    return out;
+}
+
+QDate AttendanceMatrix::termStart(const QDate& date) {
+    // 秋季学期 8 月起至次年 1 月，春季学期 2 月至 7 月。
+    if (date.month() >= 8) return QDate(date.year(), 8, 1);
+    if (date.month() == 1) return QDate(date.year() - 1, 8, 1);
+    return QDate(date.year(), 2, 1);
+}
+
+void AttendanceMatrix::benchmark(int students, int days) {
+    QStringList names;
+    names.reserve(students);
+    for (int i = 0; i < students; ++i) names.append(QString("学生%1").arg(i + 1));
+    const RosterPtr roster = Roster::fromNames(names);
+
+    // 只取工作日，每天约 3% 的学生缺勤；位图预先生成，计时只覆盖矩阵本身。
+    Rng rng(Rng::session().seed());
+    const QDate from(2026, 2, 2);
+    QVector<QDate> dates;
+    QVector<StudentSet> columns;
+    for (QDate date = from; dates.size() < days; date = date.addDays(1)) {
+        if (date.dayOfWeek() > 5) continue;
+        StudentSet set = roster->emptySet();
+        for (int i = 0; i < students / 33; ++i) set.insert(rng.bounded(students));
+        dates.append(date);
+        columns.append(set);
+    }
+
+    AttendanceMatrix matrix;
+    matrix.reset("bench", roster, from, from.addYears(1).addDays(-1));
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < dates.size(); ++i) matrix.setDay(dates.at(i), columns.at(i));
+    const double buildMs = timer.nsecsElapsed() / 1e6;
+
+    // 重新保存某一天：减去旧列、加上新列。
+    const int updates = 1000;
+    timer.restart();
+    for (int i = 0; i < updates; ++i) matrix.setDay(dates.at(i % dates.size()), columns.at((i * 7) % columns.size()));
+    const double updateUs = timer.nsecsElapsed() / 1e3 / updates;
+
+    timer.restart();
+    const QVector<StudentAttendance> rows = matrix.report();
+    const double reportMs = timer.nsecsElapsed() / 1e6;
+    qint64 checksum = matrix.totalAbsences();
+    for (const StudentAttendance& row : rows) checksum += row.longestStreak;
+
+    Logger::instance().info(QString("考勤统计基准：%1 名学生 × %2 天，逐日写入 %3 ms，单日重存 %4 us/次，"
+                                    "全校报表 %5 ms（校验 %6）")
+                                .arg(students)
+                                .arg(dates.size())
+                                .arg(buildMs, 0, 'f', 2)
+                                .arg(updateUs, 0, 'f', 2)
+                                .arg(reportMs, 0, 'f', 3)
+                                .arg(checksum));
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Roster.h"
+
+#include <QDate>
+#include <QString>
+#include <QVector>
+
+#include <array>
+
+struct StudentAttendance {
+    StudentId id = -1;
+    int absences = 0;
+    int longestStreak = 0;
+    int currentStreak = 0;
+    std::array<int, 7> weekdayAbsences{};  // 下标 0 为周一
+};
+
+// 考勤矩阵：每个记录日一列 StudentSet 位图（一位对应一名学生）。
+// 列级汇总直接对 64 位字做 popcount，学生级计数在 setDay 时按增量加减，不整体重算。
+class AttendanceMatrix {
+public:
+    void load(const QString& classKey, const RosterPtr& roster, const QDate& from, const QDate& to);
+    void setDay(const QDate& date, const StudentSet& absentees);
+
+    const QString& classKey() const { return m_classKey; }
+    const RosterPtr& roster() const { return m_roster; }
+    QDate from() const { return m_from; }
+    QDate to() const { return m_to; }
+    int dayCount() const { return m_days.size(); }
+    int weekdayDayCount(int weekday) const { return m_weekdayDays[weekday]; }
+    int weekdayAbsentCount(int weekday) const { return m_weekdayAbsent[weekday]; }
+    int absentCount(int column) const { return m_columnAbsent.at(column); }
+    int totalAbsences() const;
+    double attendanceRate(StudentId id) const;
+    QVector<StudentAttendance> report() const;
+
+    static QDate termStart(const QDate& date);
+    // 基准：students 人 × days 个工作日的合成数据，不读写考勤记录。
+    static void benchmark(int students, int days);
+
+private:
+    void reset(const QString& classKey, const RosterPtr& roster, const QDate& from, const QDate& to);
+    void accumulate(int column, int sign);
+
+    QString m_classKey;
+    RosterPtr m_roster;
+    QDate m_from;
+    QDate m_to;
+    QVector<int> m_days;  // 儒略日，升序
+    QVector<StudentSet> m_columns;
+    QVector<int> m_columnAbsent;
+    QVector<int> m_absences;
+    QVector<int> m_weekdayAbsences;  // 按学生排列，每人 7 个计数
+    std::array<int, 7> m_weekdayDays{};
+    std::array<int, 7> m_weekdayAbsent{};
+};
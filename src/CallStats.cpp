@@ -0,0 +1,118 @@
+#include "CallStats.h"
+
+#include "Utils.h"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+#include <cmath>
+
+namespace {
+constexpr quint32 kStatsMagic = 0x43464353;  // "CFCS"
+constexpr quint32 kStatsVersion = 1;
+constexpr double kRecencyHalfLifeHours = 24.0;
+}
+
+CallStats& CallStats::instance() {
+    static CallStats stats;
+    return stats;
+}
+
+CallStats::CallStats() {
+    const QString dataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(dataPath);
+    m_path = dataPath + "/callstats.bin";
+}
+
+void CallStats::ensureLoaded() {
+    if (m_loaded) return;
+    m_loaded = true;
+    load();
+}
+
+void CallStats::load() {
+    QFile file(m_path);
+    if (!file.open(QIODevice::ReadOnly)) return;
+
+    // 姓名以 UTF-8 存储；记录格式：班级数，逐班级 [班级 ID, 人数, 逐人 [姓名, 次数, 最近时间]]。
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_12);
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 classCount = 0;
+    in >> magic >> version >> classCount;
+    if (in.status() != QDataStream::Ok || magic != kStatsMagic || version != kStatsVersion) {
+        Logger::instance().warn("点名统计文件格式无法识别，已忽略");
+        return;
+    }
+    for (quint32 c = 0; c < classCount && in.status() == QDataStream::Ok; ++c) {
+        QByteArray classKey;
+        quint32 n = 0;
+        in >> classKey >> n;
+        QHash<QString, Entry>& entries = m_classes[QString::fromUtf8(classKey)];
+        for (quint32 i = 0; i < n && in.status() == QDataStream::Ok; ++i) {
+            QByteArray name;
+            Entry entry;
+            in >> name >> entry.count >> entry.lastCalledMs;
+            entries.insert(QString::fromUtf8(name), entry);
+        }
+    }
+    if (in.status() != QDataStream::Ok) {
+        Logger::instance().warn("点名统计文件不完整，已读取的部分继续使用");
+    }
+}
+
+bool CallStats::save() const {
+    QSaveFile file(m_path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        Logger::instance().warn(QString("点名统计写入失败：%1").arg(file.errorString()));
+        return false;
+    }
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_12);
+    out << kStatsMagic << kStatsVersion << quint32(m_classes.size());
+    for (auto it = m_classes.cbegin(); it != m_classes.cend(); ++it) {
+        out << it.key().toUtf8() << quint32(it->size());
+        for (auto e = it->cbegin(); e != it->cend(); ++e) {
+            out << e.key().toUtf8() << e->count << e->lastCalledMs;
+        }
+    }
+    return out.status() == QDataStream::Ok && file.commit();
+}
+
+void CallStats::record(const QString& classKey, const QStringList& names) {
+    ensureLoaded();
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    QHash<QString, Entry>& entries = m_classes[classKey];
+    for (const QString& name : names) {
+        Entry& entry = entries[name];
+        ++entry.count;
+        entry.lastCalledMs = now;
+    }
+    save();
+}
+
+int CallStats::count(const QString& classKey, const QString& studentKey) const {
+    return int(m_classes.value(classKey).value(studentKey).count);
+}
+
+QVector<double> CallStats::weights(const QString& classKey, const Roster& roster) const {
+    QVector<double> out(roster.size(), 1.0);
+    const auto it = m_classes.constFind(classKey);
+    if (it == m_classes.constEnd()) return out;
+
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    const QStringList keys = roster.keys(roster.allSet());
+    for (StudentId id = 0; id < roster.size(); ++id) {
+        const auto entry = it->constFind(keys.at(id));
+        if (entry == it->constEnd()) continue;
+        const double hours = qMax<qint64>(0, now - entry->lastCalledMs) / 3600000.0;
+        const double recency = 1.0 - 0.5 * std::exp2(-hours / kRecencyHalfLifeHours);
+        out[id] = recency / (1.0 + entry->count);
+    }
+    return out;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Roster.h"
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+// 点名次数统计：按班级、学生键（见 Roster::keys）记录累计被点次数与最近一次时间，保存在 callstats.bin。
+// 第一次打开点名窗口时才读取文件，之后每次锁定结果立即写回。
+class CallStats {
+public:
+    static CallStats& instance();
+
+    void ensureLoaded();
+    void record(const QString& classKey, const QStringList& names);
+    int count(const QString& classKey, const QString& studentKey) const;
+
+    // 公平权重：次数越多权重越低，刚被点过的学生再额外压低，随时间恢复。
+    QVector<double> weights(const QString& classKey, const Roster& roster) const;
+
+private:
+    struct Entry {
+        quint32 count = 0;
+        qint64 lastCalledMs = 0;
+    };
+
+    CallStats();
+    void load();
+    bool save() const;
+
+    QString m_path;
+    bool m_loaded = false;
+    QHash<QString, QHash<QString, Entry>> m_classes;
+};
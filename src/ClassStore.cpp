@@ -0,0 +1,153 @@
+#include "ClassStore.h"
+
+#include "Utils.h"
+
+#include <QCborArray>
+#include <QCborValue>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QUuid>
+
+namespace {
+constexpr int kCachedClasses = 3;
+}
+
+ClassStore::ClassStore(const QString& dir) : m_dir(dir) {
+    QDir().mkpath(m_dir);
+    loadIndex();
+}
+
+void ClassStore::loadIndex() {
+    QFile file(m_dir + "/index.json");
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+    const QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+    for (const auto& v : root.value("classes").toArray()) {
+        const QJsonObject o = v.toObject();
+        const QString id = o.value("id").toString();
+        if (id.isEmpty() || !QFile::exists(rosterPath(id))) continue;
+        m_classes.append({id, o.value("name").toString(id)});
+    }
+    m_activeId = root.value("active").toString();
+    if (!contains(m_activeId)) {
+        m_activeId.clear();
+    }
+}
+
+bool ClassStore::saveIndex() const {
+    QJsonArray classes;
+    for (const ClassInfo& info : m_classes) {
+        QJsonObject o;
+        o["id"] = info.id;
+        o["name"] = info.name;
+        classes.append(o);
+    }
+    QJsonObject root;
+    root["active"] = m_activeId;
+    root["classes"] = classes;
+
+    QSaveFile file(m_dir + "/index.json");
+    if (!file.open(QIODevice::WriteOnly)) {
+        Logger::instance().warn(QString("班级索引写入失败：%1").arg(file.errorString()));
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    return file.commit();
+}
+
+QString ClassStore::rosterPath(const QString& id) const {
+    return m_dir + "/" + id + ".cbor";
+}
+
+QVector<ClassInfo> ClassStore::classes() const {
+    return m_classes;
+}
+
+QString ClassStore::activeId() const {
+    return m_activeId;
+}
+
+QString ClassStore::nameOf(const QString& id) const {
+    for (const ClassInfo& info : m_classes) {
+        if (info.id == id) return info.name;
+    }
+    return QString();
+}
+
+bool ClassStore::contains(const QString& id) const {
+    for (const ClassInfo& info : m_classes) {
+        if (info.id == id) return true;
+    }
+    return false;
+}
+
+void ClassStore::setActiveId(const QString& id) {
+    if (id == m_activeId || (!id.isEmpty() && !contains(id))) {
+        return;
+    }
+    m_activeId = id;
+    saveIndex();
+}
+
+void ClassStore::touch(const QString& id, const RosterPtr& roster) {
+    m_cache.insert(id, roster);
+    m_recent.removeAll(id);
+    m_recent.prepend(id);
+    while (m_recent.size() > kCachedClasses) {
+        m_cache.remove(m_recent.takeLast());
+    }
+}
+
+RosterPtr ClassStore::load(const QString& id) {
+    const auto cached = m_cache.constFind(id);
+    if (cached != m_cache.constEnd()) {
+        const RosterPtr roster = *cached;
+        touch(id, roster);
+        return roster;
+    }
+    if (!contains(id)) {
+        return nullptr;
+    }
+
+    QFile file(rosterPath(id));
+    if (!file.open(QIODevice::ReadOnly)) {
+        Logger::instance().warn(QString("班级名单读取失败：%1").arg(id));
+        return nullptr;
+    }
+    const RosterPtr roster = Roster::fromJson(QCborValue::fromCbor(file.readAll()).toArray().toJsonArray());
+    touch(id, roster);
+    return roster;
+}
+
+bool ClassStore::store(const QString& id, const RosterPtr& roster) {
+    if (!contains(id) || !roster) {
+        return false;
+    }
+    QSaveFile file(rosterPath(id));
+    if (!file.open(QIODevice::WriteOnly)) {
+        Logger::instance().warn(QString("班级名单写入失败：%1").arg(file.errorString()));
+        return false;
+    }
+    file.write(QCborArray::fromJsonArray(roster->toJson()).toCborValue().toCbor());
+    if (!file.commit()) {
+        return false;
+    }
+    touch(id, roster);
+    return true;
+}
+
+QString ClassStore::create(const QString& name, const RosterPtr& roster) {
+    const QString id = QUuid::createUuid().toString(QUuid::Id128).left(12);
+    m_classes.append({id, name});
+    if (!store(id, roster)) {
+        m_classes.removeLast();
+        return QString();
+    }
+    saveIndex();
+    return id;
+}
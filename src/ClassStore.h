@@ -0,0 +1,42 @@
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "Roster.h"
+
+struct ClassInfo {
+    QString id;
+    QString name;
+};
+
+// 多班级名单存储：classes/index.json 记录班级列表与当前班级，每个班级的名单单独存为 <id>.cbor。
+// 只在切换时按需读取名单，最近使用的几个班级缓存在内存里，切换不会改写 config.json。
+class ClassStore {
+public:
+    explicit ClassStore(const QString& dir);
+
+    QVector<ClassInfo> classes() const;
+    QString activeId() const;
+    QString nameOf(const QString& id) const;
+    bool contains(const QString& id) const;
+    void setActiveId(const QString& id);
+
+    RosterPtr load(const QString& id);
+    bool store(const QString& id, const RosterPtr& roster);
+    QString create(const QString& name, const RosterPtr& roster);
+
+private:
+    void loadIndex();
+    bool saveIndex() const;
+    QString rosterPath(const QString& id) const;
+    void touch(const QString& id, const RosterPtr& roster);
+
+    QString m_dir;
+    QVector<ClassInfo> m_classes;
+    QString m_activeId;
+    QHash<QString, RosterPtr> m_cache;
+    QStringList m_recent;  // 最近使用在前
+};
@@ -0,0 +1,118 @@
+#include "ConfigWatcher.h"
+
+#include "ConfigWriter.h"
+#include "Utils.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QThread>
+#include <QTimer>
+
+namespace {
+constexpr int kDebounceMs = 300;
+}
+
+ConfigWatcher::ConfigWatcher(const QString& path, const ConfigWriter* writer, QObject* parent)
+    : QObject(parent), m_path(path), m_writer(writer) {
+    m_debounce = new QTimer(this);
+    m_debounce->setSingleShot(true);
+    m_debounce->setInterval(kDebounceMs);
+    connect(m_debounce, &QTimer::timeout, this, &ConfigWatcher::startReload);
+
+    // 同时监视所在目录：原子替换（重命名）后文件监视会失效，需要靠目录事件重新挂上。
+    // 目录里还有快照、点名统计、积分等文件频繁替换，目录事件只在 config.json 本身变化时才处理。
+    m_watcher = new QFileSystemWatcher(this);
+    m_watcher->addPath(QFileInfo(path).absolutePath());
+    m_stamp = stampOf(m_path);
+    rewatch();
+    connect(m_watcher, &QFileSystemWatcher::fileChanged, this, &ConfigWatcher::scheduleReload);
+    connect(m_watcher, &QFileSystemWatcher::directoryChanged, this, &ConfigWatcher::onDirectoryChanged);
+}
+
+ConfigWatcher::~ConfigWatcher() {
+    if (m_worker) {
+        m_worker->wait();
+        delete m_worker;
+    }
+}
+
+void ConfigWatcher::rewatch() {
+    if (!m_watcher->files().contains(m_path) && QFileInfo::exists(m_path)) {
+        m_watcher->addPath(m_path);
+    }
+}
+
+ConfigWatcher::FileStamp ConfigWatcher::stampOf(const QString& path) {
+    const QFileInfo info(path);
+    FileStamp stamp;
+    if (!info.exists()) return stamp;
+    stamp.size = info.size();
+    stamp.modifiedMs = info.lastModified().toMSecsSinceEpoch();
+    const QDateTime created = info.birthTime();  // 部分文件系统不提供创建时间
+    if (created.isValid()) stamp.createdMs = created.toMSecsSinceEpoch();
+    return stamp;
+}
+
+void ConfigWatcher::onDirectoryChanged() {
+    const FileStamp stamp = stampOf(m_path);
+    if (stamp == m_stamp) return;
+    m_stamp = stamp;
+    rewatch();
+    m_debounce->start();
+}
+
+void ConfigWatcher::scheduleReload() {
+    m_stamp = stampOf(m_path);
+    rewatch();
+    m_debounce->start();
+}
+
+void ConfigWatcher::startReload() {
+    if (m_worker) {
+        m_rescan = true;
+        return;
+    }
+
+    m_resultValid = false;
+    m_worker = QThread::create([this]() {
+        QFile file(m_path);
+        if (!file.open(QIODevice::ReadOnly)) return;
+        const QByteArray data = file.readAll();
+        if (QCryptographicHash::hash(data, QCryptographicHash::Md5) == m_writer->lastWrittenDigest()) {
+            return;
+        }
+        QJsonParseError error;
+        const QJsonDocument doc = QJsonDocument::fromJson(data, &error);
+        if (!doc.isObject()) {
+            // 部署工具可能正在写入，等下一次变更事件再读。
+            Logger::instance().warn(QString("外部配置解析失败：%1").arg(error.errorString()));
+            return;
+        }
+        m_result = doc.object();
+        m_resultValid = true;
+    });
+    m_worker->setObjectName("ConfigReload");
+    connect(m_worker, &QThread::finished, this, &ConfigWatcher::finishReload);
+    m_worker->start(QThread::LowPriority);
+}
+
+void ConfigWatcher::finishReload() {
+    m_worker->deleteLater();
+    m_worker = nullptr;
+
+    if (m_resultValid) {
+        m_resultValid = false;
+        const QJsonObject root = m_result;
+        m_result = QJsonObject();
+        emit changedOnDisk(root);
+    }
+    if (m_rescan) {
+        m_rescan = false;
+        m_debounce->start();
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+
+class ConfigWriter;
+class QFileSystemWatcher;
+class QThread;
+class QTimer;
+
+// 监视 config.json 的外部修改：合并连续的变更事件，在工作线程读取并解析，
+// 内容摘要与本进程最近一次写入相同的变更（即自己的 save）直接忽略。
+class ConfigWatcher : public QObject {
+    Q_OBJECT
+public:
+    ConfigWatcher(const QString& path, const ConfigWriter* writer, QObject* parent = nullptr);
+    ~ConfigWatcher() override;
+
+signals:
+    void changedOnDisk(const QJsonObject& root);
+
+private:
+    // config.json 自身的大小、修改时间与创建时间；创建时间变化说明文件被整体替换。
+    struct FileStamp {
+        qint64 size = -1;
+        qint64 modifiedMs = -1;
+        qint64 createdMs = -1;
+        bool operator==(const FileStamp& o) const {
+            return size == o.size && modifiedMs == o.modifiedMs && createdMs == o.createdMs;
+        }
+    };
+    static FileStamp stampOf(const QString& path);
+
+    void onDirectoryChanged();
+    void scheduleReload();
+    void startReload();
+    void finishReload();
+    void rewatch();
+
+    QString m_path;
+    const ConfigWriter* m_writer = nullptr;
+    QFileSystemWatcher* m_watcher = nullptr;
+    QTimer* m_debounce = nullptr;
+    QThread* m_worker = nullptr;
+    FileStamp m_stamp;
+    bool m_rescan = false;
+
+    // 仅由工作线程写入，线程结束后才在 UI 线程读取。
+    QJsonObject m_result;
+    bool m_resultValid = false;
+};
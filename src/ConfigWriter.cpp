@@ -0,0 +1,180 @@
+#include "ConfigWriter.h"
+
+#include "Utils.h"
+
+#include <QCborMap>
+#include <QCborValue>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QTimer>
+
+namespace {
+constexpr int kCoalesceWindowMs = 400;
+constexpr quint32 kSnapshotMagic = 0x43465342;  // "CFSB"
+constexpr quint32 kSnapshotVersion = 1;
+}
+
+ConfigWriter::ConfigWriter(const QString& path) : m_path(path) {
+    const QFileInfo info(path);
+    m_snapshotPath = info.absolutePath() + "/" + info.completeBaseName() + ".cbor";
+    m_thread.setObjectName("ConfigWriter");
+    m_timer = new QTimer;
+    m_timer->setSingleShot(true);
+    m_timer->setInterval(kCoalesceWindowMs);
+    m_timer->moveToThread(&m_thread);
+    QObject::connect(m_timer, &QTimer::timeout, m_timer, [this]() { writePending(); });
+    QObject::connect(&m_thread, &QThread::finished, m_timer, &QObject::deleteLater);
+    m_thread.start(QThread::LowPriority);
+}
+
+ConfigWriter::~ConfigWriter() {
+    shutdown();
+}
+
+void ConfigWriter::schedule(const QJsonObject& root) {
+    enqueue(root, true);
+}
+
+void ConfigWriter::scheduleSnapshot(const QJsonObject& root) {
+    enqueue(root, false);
+}
+
+void ConfigWriter::enqueue(const QJsonObject& root, bool writeJson) {
+    bool stopped = false;
+    {
+        QMutexLocker locker(&m_pendingMutex);
+        m_pending = root;
+        m_dirty = true;
+        m_jsonDirty = m_jsonDirty || writeJson;
+        stopped = m_stopped;
+    }
+
+    if (stopped) {
+        flush();
+        return;
+    }
+
+    // 窗口从第一次标脏开始计时，拖动悬浮球等连续修改不会把写入无限推迟。
+    QMetaObject::invokeMethod(m_timer, [this]() {
+        if (!m_timer->isActive()) m_timer->start();
+    }, Qt::QueuedConnection);
+}
+
+void ConfigWriter::flush() {
+    writePending();
+}
+
+void ConfigWriter::shutdown() {
+    {
+        QMutexLocker locker(&m_pendingMutex);
+        if (m_stopped) return;
+        m_stopped = true;
+    }
+    m_thread.quit();
+    m_thread.wait();
+    writePending();
+}
+
+bool ConfigWriter::isDirty() const {
+    QMutexLocker locker(&m_pendingMutex);
+    return m_dirty;
+}
+
+QString ConfigWriter::snapshotPath() const {
+    return m_snapshotPath;
+}
+
+QByteArray ConfigWriter::lastWrittenDigest() const {
+    QMutexLocker locker(&m_pendingMutex);
+    return m_lastDigest;
+}
+
+void ConfigWriter::writePending() {
+    QMutexLocker fileLocker(&m_fileMutex);
+    QJsonObject root;
+    bool writeJson = false;
+    {
+        QMutexLocker locker(&m_pendingMutex);
+        if (!m_dirty) return;
+        root = m_pending;
+        writeJson = m_jsonDirty;
+        m_pending = QJsonObject();
+        m_dirty = false;
+        m_jsonDirty = false;
+    }
+    if (writeJson && !writeFile(root)) {
+        QFile::remove(m_snapshotPath);
+        return;
+    }
+    writeSnapshot(root);
+}
+
+bool ConfigWriter::writeFile(const QJsonObject& root) {
+    QSaveFile file(m_path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        Logger::instance().warn(QString("配置写入失败：%1").arg(file.errorString()));
+        return false;
+    }
+    const QByteArray data = QJsonDocument(root).toJson(QJsonDocument::Indented);
+    // 先登记摘要再替换文件，监视器收到自身写入的事件时一定能识别出来。
+    {
+        QMutexLocker locker(&m_pendingMutex);
+        m_lastDigest = QCryptographicHash::hash(data, QCryptographicHash::Md5);
+    }
+    file.write(data);
+    if (!file.commit()) {
+        Logger::instance().warn(QString("配置替换失败：%1").arg(file.errorString()));
+        return false;
+    }
+    return true;
+}
+
+void ConfigWriter::writeSnapshot(const QJsonObject& root) {
+    const QFileInfo jsonInfo(m_path);
+    if (!jsonInfo.exists()) return;
+
+    const QByteArray payload = QCborMap::fromJsonObject(root).toCborValue().toCbor();
+    QSaveFile file(m_snapshotPath);
+    if (!file.open(QIODevice::WriteOnly)) return;
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_12);
+    out << kSnapshotMagic << kSnapshotVersion
+        << static_cast<qint64>(jsonInfo.size())
+        << static_cast<qint64>(jsonInfo.lastModified().toMSecsSinceEpoch())
+        << QCryptographicHash::hash(payload, QCryptographicHash::Md5)
+        << payload;
+    if (out.status() != QDataStream::Ok || !file.commit()) {
+        Logger::instance().warn(QString("配置快照写入失败：%1").arg(file.errorString()));
+    }
+}
+
+bool ConfigWriter::readSnapshot(const QString& snapshotPath, const QFileInfo& jsonInfo, QByteArray* payload) {
+    QFile file(snapshotPath);
+    if (!file.open(QIODevice::ReadOnly)) return false;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_12);
+    quint32 magic = 0;
+    quint32 version = 0;
+    qint64 jsonSize = -1;
+    qint64 jsonMtime = -1;
+    QByteArray checksum;
+    in >> magic >> version >> jsonSize >> jsonMtime;
+    if (in.status() != QDataStream::Ok || magic != kSnapshotMagic || version != kSnapshotVersion) {
+        return false;
+    }
+    // config.json 被外部修改过（大小或修改时间变化）时快照作废，回退到 JSON。
+    if (jsonSize != jsonInfo.size() || jsonMtime != jsonInfo.lastModified().toMSecsSinceEpoch()) {
+        return false;
+    }
+    in >> checksum >> *payload;
+    if (in.status() != QDataStream::Ok) return false;
+    return QCryptographicHash::hash(*payload, QCryptographicHash::Md5) == checksum;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QMutex>
+#include <QString>
+#include <QThread>
+
+class QFileInfo;
+class QTimer;
+
+// 配置写回：save() 只登记脏数据，工作线程在合并窗口结束后统一序列化并原子替换文件。
+// 每次写入 config.json 后同时生成二进制快照 config.cbor，冷启动时可跳过 JSON 解析。
+class ConfigWriter {
+public:
+    explicit ConfigWriter(const QString& path);
+    ~ConfigWriter();
+
+    void schedule(const QJsonObject& root);
+    void scheduleSnapshot(const QJsonObject& root);
+    void flush();
+    void shutdown();
+    bool isDirty() const;
+    QString snapshotPath() const;
+    QByteArray lastWrittenDigest() const;
+
+    static bool readSnapshot(const QString& snapshotPath, const QFileInfo& jsonInfo, QByteArray* payload);
+
+private:
+    void enqueue(const QJsonObject& root, bool writeJson);
+    void writePending();
+    bool writeFile(const QJsonObject& root);
+    void writeSnapshot(const QJsonObject& root);
+
+    QString m_path;
+    QString m_snapshotPath;
+    QThread m_thread;
+    QTimer* m_timer = nullptr;
+    QJsonObject m_pending;
+    bool m_dirty = false;
+    bool m_jsonDirty = false;
+    bool m_stopped = false;
+    QByteArray m_lastDigest;
+    mutable QMutex m_pendingMutex;
+    QMutex m_fileMutex;
+};
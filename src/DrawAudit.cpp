@@ -0,0 +1,206 @@
+#include "DrawAudit.h"
+
+#include "DrawEngine.h"
+#include "GroupOptimizer.h"
+#include "Random.h"
+#include "Utils.h"
+
+#include <QElapsedTimer>
+#include <QTextStream>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+// 搭档统计是 n²/2 的矩阵，名单上限取 2000（约 200 万对）。
+constexpr int kMaxRoster = 2000;
+
+int intOption(const QStringList& arguments, const QString& name, int fallback, int lo, int hi) {
+    const QString prefix = "--" + name + "=";
+    for (const QString& arg : arguments) {
+        if (!arg.startsWith(prefix)) continue;
+        bool ok = false;
+        const int value = arg.mid(prefix.size()).toInt(&ok);
+        if (ok) return qBound(lo, value, hi);
+    }
+    return fallback;
+}
+
+// 上三角（a < b）按行展开的下标，用 64 位计算避免大名单溢出。
+qint64 pairIndex(StudentId a, StudentId b) {
+    if (a > b) std::swap(a, b);
+    return qint64(b) * (b - 1) / 2 + a;
+}
+
+struct ChiSquare {
+    double statistic = 0.0;
+    int df = 0;
+    double p = 1.0;
+};
+
+// 卡方上侧概率用 Wilson–Hilferty 立方根近似，自由度较大时误差可以忽略。
+ChiSquare chiSquare(const QVector<qint64>& observed, const QVector<double>& expected) {
+    ChiSquare result;
+    for (int i = 0; i < observed.size(); ++i) {
+        if (expected.at(i) <= 0.0) continue;
+        const double d = observed.at(i) - expected.at(i);
+        result.statistic += d * d / expected.at(i);
+        ++result.df;
+    }
+    result.df = qMax(1, result.df - 1);
+    const double k = result.df;
+    const double z = (std::cbrt(result.statistic / k) - (1.0 - 2.0 / (9.0 * k))) / std::sqrt(2.0 / (9.0 * k));
+    result.p = 0.5 * std::erfc(z / std::sqrt(2.0));
+    return result;
+}
+
+QString describe(const ChiSquare& chi) {
+    return QString("χ²=%1 (df=%2, p=%3)").arg(chi.statistic, 0, 'f', 1).arg(chi.df).arg(chi.p, 0, 'f', 3);
+}
+
+QString rate(qint64 count, qint64 ns) {
+    return QString::number(count / qMax(ns / 1e9, 1e-9) / 1e6, 'f', 2) + "M/s";
+}
+
+class Report {
+public:
+    Report() : m_out(stdout) {}
+    void line(const QString& text) {
+        m_out << text << '\n';
+        m_out.flush();
+        Logger::instance().info(text);
+    }
+
+private:
+    QTextStream m_out;
+};
+}  // namespace
+
+int DrawAudit::run(const QStringList& arguments) {
+    quint64 seed = Rng::session().seed();
+    Rng::parseSeed(arguments, &seed);
+    const int n = intOption(arguments, "roster", 50, 2, kMaxRoster);
+    const int draws = intOption(arguments, "draws", 5000000, 1000, 500000000);
+    const int solves = intOption(arguments, "solves", 2000, 10, 1000000);
+    const int budgetMs = intOption(arguments, "budget", 2, 1, 1000);
+    const int groupSize = intOption(arguments, "group", 4, 2, qMax(2, n));
+
+    Report report;
+    report.line(QString("抽取审计：种子 %1，名单 %2 人").arg(seed).arg(n));
+    Rng rng(seed);
+    QElapsedTimer timer;
+
+    // 1. 等概率抽取：每人被抽中次数应服从均匀分布。
+    {
+        DrawEngine engine;
+        engine.setRng(&rng);
+        engine.setNoRepeat(false);
+        engine.reset(n);
+        QVector<qint64> counts(n, 0);
+        timer.start();
+        for (int i = 0; i < draws; ++i) ++counts[engine.draw()];
+        const qint64 ns = timer.nsecsElapsed();
+        const ChiSquare chi = chiSquare(counts, QVector<double>(n, double(draws) / n));
+        const auto [minIt, maxIt] = std::minmax_element(counts.cbegin(), counts.cend());
+        report.line(QString("等概率抽取：%1 次，%2，最少 %3 / 最多 %4 次，吞吐 %5")
+                        .arg(draws).arg(describe(chi)).arg(*minIt).arg(*maxIt).arg(rate(draws, ns)));
+    }
+
+    // 2. 无重复轮次：每轮每人恰好一次，且第一个被点到的人应均匀分布。
+    {
+        DrawEngine engine;
+        engine.setRng(&rng);
+        engine.setNoRepeat(true);
+        engine.reset(n);
+        const int rounds = qMax(1, draws / n);
+        QVector<qint64> first(n, 0);
+        QVector<qint64> calls(n, 0);
+        timer.restart();
+        for (int r = 0; r < rounds; ++r) {
+            for (int i = 0; i < n; ++i) {
+                const StudentId id = engine.draw();
+                if (i == 0) ++first[id];
+                ++calls[id];
+                engine.commit(id);
+            }
+        }
+        const qint64 ns = timer.nsecsElapsed();
+        const auto [minIt, maxIt] = std::minmax_element(calls.cbegin(), calls.cend());
+        const ChiSquare chi = chiSquare(first, QVector<double>(n, double(rounds) / n));
+        report.line(QString("无重复轮次：%1 轮，每人被点 %2~%3 次（应相等），首位分布 %4，吞吐 %5")
+                        .arg(rounds).arg(*minIt).arg(*maxIt).arg(describe(chi)).arg(rate(qint64(rounds) * n, ns)));
+    }
+
+    // 3. 公平加权：抽中频率应与权重成正比。
+    {
+        DrawEngine engine;
+        engine.setRng(&rng);
+        engine.setNoRepeat(false);
+        engine.reset(n);
+        QVector<double> weights(n);
+        for (int i = 0; i < n; ++i) weights[i] = 1.0 / (1.0 + i % 5);
+        engine.setWeights(weights);
+        const double total = std::accumulate(weights.cbegin(), weights.cend(), 0.0);
+        QVector<double> expected(n);
+        for (int i = 0; i < n; ++i) expected[i] = draws * weights.at(i) / total;
+        QVector<qint64> counts(n, 0);
+        timer.restart();
+        for (int i = 0; i < draws; ++i) ++counts[engine.draw()];
+        const qint64 ns = timer.nsecsElapsed();
+        report.line(QString("公平加权：%1 次，%2，吞吐 %3").arg(draws).arg(describe(chiSquare(counts, expected))).arg(rate(draws, ns)));
+    }
+
+    // 4. 分组：审计界面实际使用的 GroupOptimizer（空搭档历史、无约束、固定时间预算）。
+    //    每人落入各组的次数应与组的大小成正比，同组搭档次数的离散度越小越公平。
+    {
+        GroupProblem problem;
+        problem.groupSize = groupSize;
+        problem.genders = QVector<int>(n, 0);
+        problem.bands = QVector<int>(n, -1);
+        problem.history = PairHistory(n);
+        problem.budgetMs = budgetMs;
+        const int groups = qMax(1, (n + groupSize - 1) / groupSize);
+        QVector<qint64> placement(n * groups, 0);
+        QVector<qint64> groupTotals(groups, 0);
+        QVector<quint32> pairs(int(pairIndex(n - 1, n - 2) + 1), 0);
+        qint64 iterations = 0;
+        timer.restart();
+        for (int s = 0; s < solves; ++s) {
+            problem.seed = rng.next();
+            const GroupPlan plan = GroupOptimizer::solve(problem);
+            iterations += plan.iterations;
+            for (int g = 0; g < plan.groups.size() && g < groups; ++g) {
+                const QVector<StudentId>& group = plan.groups.at(g);
+                groupTotals[g] += group.size();
+                for (int a = 0; a < group.size(); ++a) {
+                    ++placement[group.at(a) * groups + g];
+                    for (int b = a + 1; b < group.size(); ++b) ++pairs[int(pairIndex(group.at(a), group.at(b)))];
+                }
+            }
+        }
+        const qint64 ns = timer.nsecsElapsed();
+
+        QVector<double> expected(n * groups);
+        for (int g = 0; g < groups; ++g) {
+            for (int id = 0; id < n; ++id) expected[id * groups + g] = double(groupTotals.at(g)) / n;
+        }
+        double sum = 0.0;
+        double sumSq = 0.0;
+        int pairCount = 0;
+        for (const quint32 count : pairs) {
+            const double c = count;
+            sum += c;
+            sumSq += c * c;
+            ++pairCount;
+        }
+        const double mean = sum / qMax(1, pairCount);
+        const double cv = mean > 0.0 ? std::sqrt(qMax(0.0, sumSq / pairCount - mean * mean)) / mean : 0.0;
+        report.line(QString("优化分组：%1 次（每次预算 %2 ms，平均 %3 步），每组 %4 人，组位置 %5，"
+                            "搭档次数变异系数 %6，%7 次分组/秒")
+                        .arg(solves).arg(budgetMs).arg(iterations / qMax(1, solves)).arg(groupSize)
+                        .arg(describe(chiSquare(placement, expected))).arg(cv, 0, 'f', 4)
+                        .arg(solves / qMax(ns / 1e9, 1e-9), 0, 'f', 0));
+    }
+    return 0;
+}
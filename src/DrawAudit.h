@@ -0,0 +1,10 @@
+#pragma once
+
+#include <QStringList>
+
+// 抽取审计：不启动界面，用给定种子模拟大量点名与分组（分组走界面使用的 GroupOptimizer），
+// 输出卡方均匀性、公平性指标与吞吐量。
+// 用法：ClassFlow --audit-draws [--seed=N] [--roster=50] [--draws=5000000] [--solves=2000] [--budget=2] [--group=4]
+namespace DrawAudit {
+int run(const QStringList& arguments);
+}
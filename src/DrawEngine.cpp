@@ -0,0 +1,260 @@
+#include "DrawEngine.h"
+
+#include "Utils.h"
+
+#include <limits>
+
+namespace {
+constexpr qint64 kNeverPicked = std::numeric_limits<qint64>::min();
+}
+
+DrawEngine::DrawEngine() {
+    m_clock.start();
+}
+
+void DrawEngine::reset(int size) {
+    m_eligible.clear();
+    m_cooling.clear();
+    m_heap.clear();
+    m_eligible.reserve(size);
+    m_cooling.reserve(size);
+    m_heap.reserve(size);
+    m_slot = QVector<int>(size, -1);
+    m_where = QVector<Where>(size, Out);
+    m_cooldownUntil = QVector<qint64>(size, kNeverPicked);
+    m_weights.clear();
+    m_aliasProb = QVector<double>(size, 1.0);
+    m_alias = QVector<int>(size, 0);
+    m_small = QVector<int>(size, 0);
+    m_large = QVector<int>(size, 0);
+    m_mark = QVector<quint32>(size, 0);
+    m_markStamp = 0;
+    m_aliasDirty = true;
+    restartRound();
+}
+
+void DrawEngine::setNoRepeat(bool noRepeat) {
+    if (m_noRepeat == noRepeat) return;
+    m_noRepeat = noRepeat;
+    if (!noRepeat) restartRound();
+}
+
+void DrawEngine::setWeights(const QVector<double>& weights) {
+    m_weights = weights.size() == m_where.size() ? weights : QVector<double>();
+    m_aliasDirty = true;
+}
+
+void DrawEngine::restartRound() {
+    const qint64 t = now();
+    for (StudentId id = 0; id < m_where.size(); ++id) {
+        if (m_where.at(id) == Out) place(id, m_cooldownUntil.at(id) > t ? Cooling : Eligible);
+    }
+}
+
+void DrawEngine::place(StudentId id, Where where) {
+    QVector<StudentId>& list = where == Eligible ? m_eligible : m_cooling;
+    m_slot[id] = list.size();
+    m_where[id] = where;
+    list.append(id);
+    m_aliasDirty = true;
+}
+
+void DrawEngine::detach(StudentId id) {
+    const Where where = m_where.at(id);
+    if (where == Out) return;
+    QVector<StudentId>& list = where == Eligible ? m_eligible : m_cooling;
+    const int slot = m_slot.at(id);
+    const StudentId last = list.last();
+    list[slot] = last;
+    m_slot[last] = slot;
+    list.removeLast();
+    m_slot[id] = -1;
+    m_where[id] = Out;
+    m_aliasDirty = true;
+}
+
+void DrawEngine::expire(qint64 t) {
+    while (!m_heap.isEmpty() && m_heap.first().until <= t) {
+        const Cooldown top = m_heap.first();
+        popCooldown();
+        if (m_cooldownUntil.at(top.id) != top.until) continue;
+        m_cooldownUntil[top.id] = kNeverPicked;
+        if (m_where.at(top.id) == Cooling) {
+            detach(top.id);
+            place(top.id, Eligible);
+        }
+    }
+}
+
+StudentId DrawEngine::draw() {
+    expire(now());
+    const QVector<StudentId>& pool = m_eligible.isEmpty() ? m_cooling : m_eligible;
+    if (pool.isEmpty()) return -1;
+    const int slot = m_rng->bounded(pool.size());
+    if (m_weights.isEmpty()) return pool.at(slot);
+
+    if (m_aliasDirty || m_aliasPool != &pool) buildAlias(pool);
+    return pool.at(m_rng->generateDouble() < m_aliasProb.at(slot) ? slot : m_alias.at(slot));
+}
+
+int DrawEngine::drawMany(int k, QVector<StudentId>* out) {
+    expire(now());
+    out->clear();
+    k = qBound(0, k, remaining());
+    if (k == 0) return 0;
+    if (++m_markStamp == 0) {
+        m_mark.fill(0);
+        m_markStamp = 1;
+    }
+    // 先从可抽数组取，不够时再从冷却数组补足，与单人抽取的优先级一致。
+    sampleFrom(m_eligible, qMin(k, m_eligible.size()), out);
+    if (out->size() < k) sampleFrom(m_cooling, k - out->size(), out);
+    return out->size();
+}
+
+void DrawEngine::sampleFrom(QVector<StudentId>& pool, int need, QVector<StudentId>* out) {
+    const int n = pool.size();
+    if (need <= 0) return;
+    if (need >= n) {
+        for (const StudentId id : pool) out->append(id);
+        return;
+    }
+
+    if (m_weights.isEmpty()) {
+        // 部分 Fisher–Yates：只洗前 need 个位置，交换后同步下标表。
+        for (int i = 0; i < need; ++i) {
+            const int j = i + m_rng->bounded(n - i);
+            std::swap(pool[i], pool[j]);
+            m_slot[pool.at(i)] = i;
+            m_slot[pool.at(j)] = j;
+            out->append(pool.at(i));
+        }
+        m_aliasDirty = true;
+        return;
+    }
+
+    // 加权时按别名表抽取并拒绝重复；k 远小于候选人数时期望 O(k)。
+    if (m_aliasDirty || m_aliasPool != &pool) buildAlias(pool);
+    const int target = out->size() + need;
+    for (int attempts = 0; out->size() < target && attempts < 32 * need; ++attempts) {
+        const int slot = m_rng->bounded(n);
+        const StudentId id = pool.at(m_rng->generateDouble() < m_aliasProb.at(slot) ? slot : m_alias.at(slot));
+        if (m_mark.at(id) == m_markStamp) continue;
+        m_mark[id] = m_markStamp;
+        out->append(id);
+    }
+    // 权重极度集中时拒绝次数可能过多，剩余名额按顺序补齐。
+    for (int i = 0; i < n && out->size() < target; ++i) {
+        const StudentId id = pool.at(i);
+        if (m_mark.at(id) == m_markStamp) continue;
+        m_mark[id] = m_markStamp;
+        out->append(id);
+    }
+}
+
+void DrawEngine::buildAlias(const QVector<StudentId>& pool) {
+    // Vose 版本的别名法：概率按均值归一化后，小于 1 的槽位用大于 1 的槽位补齐。
+    const int n = pool.size();
+    double sum = 0.0;
+    for (const StudentId id : pool) sum += qMax(0.0, m_weights.at(id));
+    int smallCount = 0;
+    int largeCount = 0;
+    for (int i = 0; i < n; ++i) {
+        m_aliasProb[i] = sum > 0.0 ? qMax(0.0, m_weights.at(pool.at(i))) * n / sum : 1.0;
+        m_alias[i] = i;
+        if (m_aliasProb.at(i) < 1.0) m_small[smallCount++] = i;
+        else m_large[largeCount++] = i;
+    }
+    while (smallCount > 0 && largeCount > 0) {
+        const int s = m_small.at(--smallCount);
+        const int l = m_large.at(largeCount - 1);
+        m_alias[s] = l;
+        m_aliasProb[l] -= 1.0 - m_aliasProb.at(s);
+        if (m_aliasProb.at(l) < 1.0) {
+            --largeCount;
+            m_small[smallCount++] = l;
+        }
+    }
+    // 浮点误差留下的槽位按概率 1 处理。
+    while (largeCount > 0) m_aliasProb[m_large.at(--largeCount)] = 1.0;
+    while (smallCount > 0) m_aliasProb[m_small.at(--smallCount)] = 1.0;
+    m_aliasPool = &pool;
+    m_aliasDirty = false;
+}
+
+bool DrawEngine::commit(StudentId id) {
+    if (id < 0 || id >= m_where.size()) return false;
+    const qint64 t = now();
+    expire(t);
+    m_cooldownUntil[id] = t + kCooldownMs;
+    pushCooldown({t + kCooldownMs, id});
+    detach(id);
+    if (!m_noRepeat) {
+        place(id, Cooling);
+        return false;
+    }
+    if (remaining() > 0) return false;
+    restartRound();
+    return true;
+}
+
+void DrawEngine::pushCooldown(const Cooldown& entry) {
+    // 同一学生反复被抽会留下过期条目，堆明显大于名单时整体重建。
+    if (m_heap.size() >= 2 * qMax(1, m_where.size())) rebuildHeap();
+    m_heap.append(entry);
+    int i = m_heap.size() - 1;
+    while (i > 0) {
+        const int parent = (i - 1) / 2;
+        if (m_heap.at(parent).until <= m_heap.at(i).until) break;
+        std::swap(m_heap[parent], m_heap[i]);
+        i = parent;
+    }
+}
+
+void DrawEngine::popCooldown() {
+    m_heap[0] = m_heap.last();
+    m_heap.removeLast();
+    const int n = m_heap.size();
+    int i = 0;
+    while (true) {
+        const int left = 2 * i + 1;
+        if (left >= n) break;
+        const int child = left + 1 < n && m_heap.at(left + 1).until < m_heap.at(left).until ? left + 1 : left;
+        if (m_heap.at(i).until <= m_heap.at(child).until) break;
+        std::swap(m_heap[i], m_heap[child]);
+        i = child;
+    }
+}
+
+void DrawEngine::rebuildHeap() {
+    QVector<Cooldown> live;
+    live.reserve(m_where.size());
+    for (const Cooldown& entry : m_heap) {
+        if (m_cooldownUntil.at(entry.id) == entry.until) live.append(entry);
+    }
+    m_heap.clear();
+    for (const Cooldown& entry : live) pushCooldown(entry);
+}
+
+void DrawEngine::benchmark(int rosterSize, int draws) {
+    DrawEngine engine;
+    engine.reset(rosterSize);
+    // 先确认一部分学生，使冷却数组和堆都处于有负载的状态。
+    for (int i = 0; i < rosterSize / 2; ++i) engine.commit(engine.draw());
+
+    QElapsedTimer timer;
+    timer.start();
+    quint64 checksum = 0;
+    for (int i = 0; i < draws; ++i) checksum += quint64(engine.draw());
+    const double drawSeconds = timer.nsecsElapsed() / 1e9;
+
+    timer.restart();
+    for (int i = 0; i < rosterSize; ++i) checksum += quint64(engine.commit(engine.draw()));
+    const double commitSeconds = timer.nsecsElapsed() / 1e9;
+
+    Logger::instance().info(QString("点名抽取基准：名单 %1 人，抽取 %2 次/秒，抽取+确认 %3 次/秒（校验 %4）")
+                                .arg(rosterSize)
+                                .arg(draws / qMax(drawSeconds, 1e-9), 0, 'f', 0)
+                                .arg(rosterSize / qMax(commitSeconds, 1e-9), 0, 'f', 0)
+                                .arg(checksum));
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Random.h"
+#include "Roster.h"
+
+#include <QElapsedTimer>
+#include <QVector>
+
+// 随机点名的抽取结构：本轮候选按“可抽 / 冷却中”分成两个交换删除数组，
+// 冷却到期时间放在最小堆里，到期后移回可抽数组。抽取与确认都是 O(1) 均摊，滚动时不分配内存。
+// 设置权重后按 Walker 别名表抽取，候选或权重变化时才重建别名表。
+class DrawEngine {
+public:
+    static constexpr qint64 kCooldownMs = 15 * 60 * 1000;
+
+    DrawEngine();
+
+    void reset(int size);
+    void restartRound();
+    void setNoRepeat(bool noRepeat);
+    void setWeights(const QVector<double>& weights);  // 为空表示等概率
+    void setRng(Rng* rng) { m_rng = rng; }
+    bool noRepeat() const { return m_noRepeat; }
+    int size() const { return m_slot.size(); }
+    int remaining() const { return m_eligible.size() + m_cooling.size(); }
+
+    // 优先从未在冷却的候选中抽；全部冷却时退回整个本轮候选。
+    StudentId draw();
+    // 一次抽出 k 名互不相同的学生（不超过本轮剩余人数），规则与 draw 相同，复用 out 的容量。
+    int drawMany(int k, QVector<StudentId>* out);
+    // 锁定结果：进入冷却，无重复模式下移出本轮。本轮抽空后自动开始新一轮并返回 true。
+    bool commit(StudentId id);
+
+    static void benchmark(int rosterSize, int draws);
+
+private:
+    enum Where : qint8 { Out, Eligible, Cooling };
+    struct Cooldown {
+        qint64 until;
+        StudentId id;
+    };
+
+    qint64 now() const { return m_clock.elapsed(); }
+    void expire(qint64 now);
+    void place(StudentId id, Where where);
+    void detach(StudentId id);
+    void pushCooldown(const Cooldown& entry);
+    void popCooldown();
+    void rebuildHeap();
+    void buildAlias(const QVector<StudentId>& pool);
+    void sampleFrom(QVector<StudentId>& pool, int need, QVector<StudentId>* out);
+
+    QElapsedTimer m_clock;
+    Rng* m_rng = &Rng::session();
+    bool m_noRepeat = true;
+    QVector<StudentId> m_eligible;
+    QVector<StudentId> m_cooling;
+    QVector<int> m_slot;  // 学生在所属数组中的下标
+    QVector<Where> m_where;
+    QVector<qint64> m_cooldownUntil;  // 单调时钟毫秒，未冷却为最小值
+    QVector<Cooldown> m_heap;         // 惰性删除：与 m_cooldownUntil 不一致的条目视为过期
+
+    QVector<double> m_weights;
+    QVector<double> m_aliasProb;  // 以下均按名单大小预留，重建时不分配
+    QVector<int> m_alias;
+    QVector<int> m_small;
+    QVector<int> m_large;
+    QVector<quint32> m_mark;  // 多人抽取时的去重标记，按轮次编号比较
+    quint32 m_markStamp = 0;
+    const QVector<StudentId>* m_aliasPool = nullptr;
+    bool m_aliasDirty = true;
+};
@@ -0,0 +1,247 @@
+#include "GroupOptimizer.h"
+
+#include "Random.h"
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QRegularExpression>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+constexpr double kConstraintWeight = 1000.0;
+constexpr double kRepeatWeight = 3.0;
+constexpr double kGenderWeight = 4.0;
+constexpr double kBandWeight = 2.0;
+
+QVector<QPair<StudentId, StudentId>> parseRules(const QStringList& rules, const QHash<QString, StudentId>& ids) {
+    static const QRegularExpression separators(QStringLiteral("[、,，;；\\s]+"));
+    QVector<QPair<StudentId, StudentId>> pairs;
+    for (const QString& rule : rules) {
+        QVector<StudentId> members;
+        for (const QString& name : rule.split(separators, Qt::SkipEmptyParts)) {
+            const StudentId id = ids.value(name, -1);
+            if (id >= 0 && !members.contains(id)) members.append(id);
+        }
+        for (int i = 0; i < members.size(); ++i) {
+            for (int j = i + 1; j < members.size(); ++j) pairs.append({members.at(i), members.at(j)});
+        }
+    }
+    return pairs;
+}
+
+class Search {
+public:
+    explicit Search(const GroupProblem& problem) : p(problem), n(problem.genders.size()), rng(problem.seed) {
+        const int groupCount = qMax(1, (n + p.groupSize - 1) / p.groupSize);
+        members.resize(groupCount);
+        groupOf.resize(n);
+        slot.resize(n);
+        apart.resize(n);
+        together.resize(n);
+        for (const auto& pair : p.keepApart) {
+            apart[pair.first].append(pair.second);
+            apart[pair.second].append(pair.first);
+        }
+        for (const auto& pair : p.keepTogether) {
+            together[pair.first].append(pair.second);
+            together[pair.second].append(pair.first);
+        }
+        for (int g = 0; g < 3; ++g) {
+            genderTotal[g] = int(std::count(p.genders.cbegin(), p.genders.cend(), g));
+        }
+        bandTotal.fill(0, p.bandCount);
+        for (const int band : p.bands) {
+            if (band >= 0) ++bandTotal[band];
+        }
+        genderCount.fill(0, groupCount * 3);
+        bandCount.fill(0, groupCount * qMax(1, p.bandCount));
+    }
+
+    GroupPlan run() {
+        QElapsedTimer timer;
+        timer.start();
+        seed();
+
+        GroupPlan plan;
+        const int groupCount = members.size();
+        if (groupCount > 1 && n > 2) {
+            const qint64 budgetNs = qint64(p.budgetMs) * 1000 * 1000;
+            const double startTemperature = 2.0;
+            double temperature = startTemperature;
+            for (;;) {
+                // 每 256 次检查一次时间，避免计时本身成为开销。
+                if ((plan.iterations & 255) == 0) {
+                    const qint64 elapsed = timer.nsecsElapsed();
+                    if (elapsed >= budgetNs) break;
+                    temperature = startTemperature * (1.0 - double(elapsed) / budgetNs) + 0.01;
+                }
+                ++plan.iterations;
+                const StudentId a = rng.bounded(n);
+                const StudentId b = rng.bounded(n);
+                const int ga = groupOf.at(a);
+                const int gb = groupOf.at(b);
+                if (ga == gb) continue;
+
+                const double before = localCost(a) + localCost(b) + balanceCost(ga) + balanceCost(gb);
+                swap(a, b);
+                const double after = localCost(a) + localCost(b) + balanceCost(ga) + balanceCost(gb);
+                const double delta = after - before;
+                if (delta > 0.0 && rng.generateDouble() >= std::exp(-delta / temperature)) swap(a, b);
+            }
+        }
+
+        plan.groups = members;
+        for (StudentId s = 0; s < n; ++s) {
+            for (const StudentId t : apart.at(s)) plan.violations += t > s && groupOf.at(t) == groupOf.at(s);
+            for (const StudentId t : together.at(s)) plan.violations += t > s && groupOf.at(t) != groupOf.at(s);
+        }
+        for (const QVector<StudentId>& group : members) {
+            for (int i = 0; i < group.size(); ++i) {
+                for (int j = i + 1; j < group.size(); ++j) plan.repeatPairs += p.history.count(group.at(i), group.at(j)) > 0;
+            }
+        }
+        plan.elapsedMs = timer.nsecsElapsed() / 1e6;
+        return plan;
+    }
+
+private:
+    // 初始方案：同组约束的学生先放在一起，其余按分层排序后蛇形分配，各组容量均分。
+    void seed() {
+        const int groupCount = members.size();
+        QVector<int> capacity(groupCount, n / groupCount);
+        for (int g = 0; g < n % groupCount; ++g) ++capacity[g];
+
+        QVector<StudentId> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        rng.shuffle(order);
+        std::stable_sort(order.begin(), order.end(), [this](StudentId a, StudentId b) {
+            return std::make_pair(p.bands.at(a), p.genders.at(a)) < std::make_pair(p.bands.at(b), p.genders.at(b));
+        });
+
+        groupOf.fill(-1);
+        int cursor = 0;
+        int direction = 1;
+        const auto nextGroup = [&]() {
+            for (int tries = 0; tries < 2 * groupCount; ++tries) {
+                const int g = cursor;
+                cursor += direction;
+                if (cursor == groupCount || cursor < 0) {
+                    direction = -direction;
+                    cursor += direction;
+                }
+                if (members.at(g).size() < capacity.at(g)) return g;
+            }
+            for (int g = 0; g < groupCount; ++g) {
+                if (members.at(g).size() < capacity.at(g)) return g;
+            }
+            return 0;
+        };
+        for (const StudentId s : order) {
+            if (groupOf.at(s) >= 0) continue;
+            const int g = nextGroup();
+            place(s, g);
+            for (const StudentId t : together.at(s)) {
+                if (groupOf.at(t) < 0 && members.at(g).size() < capacity.at(g)) place(t, g);
+            }
+        }
+    }
+
+    void place(StudentId s, int g) {
+        groupOf[s] = g;
+        slot[s] = members[g].size();
+        members[g].append(s);
+        adjustCounts(s, g, 1);
+    }
+
+    void adjustCounts(StudentId s, int g, int sign) {
+        genderCount[g * 3 + p.genders.at(s)] += sign;
+        if (p.bands.at(s) >= 0) bandCount[g * p.bandCount + p.bands.at(s)] += sign;
+    }
+
+    void swap(StudentId a, StudentId b) {
+        const int ga = groupOf.at(a);
+        const int gb = groupOf.at(b);
+        members[ga][slot.at(a)] = b;
+        members[gb][slot.at(b)] = a;
+        std::swap(slot[a], slot[b]);
+        groupOf[a] = gb;
+        groupOf[b] = ga;
+        adjustCounts(a, ga, -1);
+        adjustCounts(b, gb, -1);
+        adjustCounts(a, gb, 1);
+        adjustCounts(b, ga, 1);
+    }
+
+    // 学生 s 与本组成员的重复搭档代价，加上其约束伙伴的违约代价。
+    double localCost(StudentId s) const {
+        const int g = groupOf.at(s);
+        double cost = 0.0;
+        for (const StudentId t : members.at(g)) {
+            const int c = p.history.count(s, t);
+            cost += kRepeatWeight * c * c;
+        }
+        for (const StudentId t : apart.at(s)) cost += groupOf.at(t) == g ? kConstraintWeight : 0.0;
+        for (const StudentId t : together.at(s)) cost += groupOf.at(t) != g ? kConstraintWeight : 0.0;
+        return cost;
+    }
+
+    double balanceCost(int g) const {
+        const double share = double(members.at(g).size()) / n;
+        double cost = 0.0;
+        for (int k = 1; k < 3; ++k) {
+            const double d = genderCount.at(g * 3 + k) - share * genderTotal[k];
+            cost += kGenderWeight * d * d;
+        }
+        for (int band = 0; band < p.bandCount; ++band) {
+            const double d = bandCount.at(g * p.bandCount + band) - share * bandTotal.at(band);
+            cost += kBandWeight * d * d;
+        }
+        return cost;
+    }
+
+    const GroupProblem& p;
+    const int n;
+    Rng rng;
+    QVector<QVector<StudentId>> members;
+    QVector<int> groupOf;
+    QVector<int> slot;
+    QVector<QVector<StudentId>> apart;
+    QVector<QVector<StudentId>> together;
+    int genderTotal[3] = {};
+    QVector<int> bandTotal;
+    QVector<int> genderCount;
+    QVector<int> bandCount;
+};
+}  // namespace
+
+GroupProblem GroupProblem::fromRoster(const Roster& roster, int groupSize, const QStringList& keepApart,
+                                      const QStringList& keepTogether) {
+    GroupProblem problem;
+    problem.groupSize = qMax(2, groupSize);
+    problem.genders.resize(roster.size());
+    problem.bands.resize(roster.size());
+    QHash<QString, int> bandIds;
+    QHash<QString, StudentId> ids;
+    for (StudentId id = 0; id < roster.size(); ++id) {
+        ids.insert(roster.name(id), id);
+        problem.genders[id] = int(roster.gender(id));
+        const QString band = roster.group(id).trimmed();
+        if (band.isEmpty()) {
+            problem.bands[id] = -1;
+            continue;
+        }
+        if (!bandIds.contains(band)) bandIds.insert(band, bandIds.size());
+        problem.bands[id] = bandIds.value(band);
+    }
+    problem.bandCount = bandIds.size();
+    problem.keepApart = parseRules(keepApart, ids);
+    problem.keepTogether = parseRules(keepTogether, ids);
+    return problem;
+}
+
+GroupPlan GroupOptimizer::solve(const GroupProblem& problem) {
+    return Search(problem).run();
+}
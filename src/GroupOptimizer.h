@@ -0,0 +1,37 @@
+#pragma once
+
+#include "PairHistory.h"
+#include "Roster.h"
+
+#include <QPair>
+#include <QVector>
+
+struct GroupProblem {
+    int groupSize = 4;
+    QVector<int> genders;  // 0 未知，1 男，2 女
+    QVector<int> bands;    // 分层编号，-1 表示未填写
+    int bandCount = 0;
+    QVector<QPair<StudentId, StudentId>> keepApart;
+    QVector<QPair<StudentId, StudentId>> keepTogether;
+    PairHistory history;
+    quint64 seed = 0;
+    int budgetMs = 30;
+
+    static GroupProblem fromRoster(const Roster& roster, int groupSize, const QStringList& keepApart,
+                                   const QStringList& keepTogether);
+};
+
+struct GroupPlan {
+    QVector<QVector<StudentId>> groups;
+    int repeatPairs = 0;  // 曾经同组过的搭档对数
+    int violations = 0;   // 未满足的同组 / 不同组约束
+    int iterations = 0;
+    double elapsedMs = 0.0;
+};
+
+// 分组优化：组数按人数均分（各组人数相差不超过 1），先按分层蛇形铺开，
+// 再在限定时间内做两两交换的局部搜索（模拟退火），目标是少重复搭档、满足约束、性别与分层均衡。
+// 只读取 GroupProblem，可在工作线程运行。
+namespace GroupOptimizer {
+GroupPlan solve(const GroupProblem& problem);
+}
@@ -0,0 +1,113 @@
+#include "IdleMonitor.h"
+
+#include "TimerWheel.h"
+
+#include <QCoreApplication>
+#include <QEvent>
+
+#ifdef Q_OS_WIN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
+
+namespace {
+// 截止时间允许推迟的量，让检测和其他秒级定时器合并唤醒。
+constexpr qint64 kSlackMs = 1000;
+
+// 系统级的无输入时长；平台不支持时返回 -1。
+qint64 systemIdleMs() {
+#ifdef Q_OS_WIN
+    LASTINPUTINFO info;
+    info.cbSize = sizeof(info);
+    if (!GetLastInputInfo(&info)) return -1;
+    // 两者都是 32 位毫秒计数，无符号相减在 49 天回绕时依然正确。
+    return static_cast<qint64>(static_cast<DWORD>(GetTickCount() - info.dwTime));
+#else
+    return -1;
+#endif
+}
+}
+
+IdleMonitor& IdleMonitor::instance() {
+    static IdleMonitor monitor;
+    return monitor;
+}
+
+IdleMonitor::IdleMonitor() {
+    m_clock.start();
+}
+
+bool IdleMonitor::hasSystemIdleTime() {
+    static const bool available = systemIdleMs() >= 0;
+    return available;
+}
+
+void IdleMonitor::start(qint64 thresholdMs) {
+    thresholdMs = qMax<qint64>(1000, thresholdMs);
+    if (isRunning() && thresholdMs == m_thresholdMs) return;
+    stop();
+    m_thresholdMs = thresholdMs;
+    m_startedMs = m_clock.elapsed();
+    m_lastInputMs = m_startedMs;
+    if (!hasSystemIdleTime() && !m_filterInstalled) {
+        QCoreApplication::instance()->installEventFilter(this);
+        m_filterInstalled = true;
+    }
+    arm(m_thresholdMs);
+}
+
+void IdleMonitor::stop() {
+    TimerWheel::instance().cancel(m_timer);
+    m_timer = 0;
+    if (m_filterInstalled) {
+        QCoreApplication::instance()->removeEventFilter(this);
+        m_filterInstalled = false;
+    }
+}
+
+qint64 IdleMonitor::idleMs() const {
+    const qint64 sinceStart = m_clock.elapsed() - m_startedMs;
+    const qint64 system = systemIdleMs();
+    if (system >= 0) return qMin(system, sinceStart);
+    return m_clock.elapsed() - m_lastInputMs;
+}
+
+void IdleMonitor::arm(qint64 delayMs) {
+    m_timer = TimerWheel::instance().schedule(delayMs, this, [this]() {
+        m_timer = 0;
+        check();
+    }, kSlackMs);
+}
+
+void IdleMonitor::check() {
+    const qint64 quietMs = idleMs();
+    if (quietMs < m_thresholdMs) {
+        arm(m_thresholdMs - quietMs);
+        return;
+    }
+    stop();
+    emit idle();
+}
+
+bool IdleMonitor::eventFilter(QObject* watched, QEvent* event) {
+    switch (event->type()) {
+    case QEvent::MouseMove:
+    case QEvent::MouseButtonPress:
+    case QEvent::KeyPress:
+    case QEvent::Wheel:
+    case QEvent::TouchBegin:
+    case QEvent::TouchUpdate:
+    case QEvent::TabletPress:
+    case QEvent::TabletMove:
+        m_lastInputMs = m_clock.elapsed();
+        break;
+    default:
+        break;
+    }
+    return QObject::eventFilter(watched, event);
+}
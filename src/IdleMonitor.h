@@ -0,0 +1,40 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QObject>
+
+// 无操作检测：start() 后只在时间轮上挂一个截止时间，到点时再查询距最近一次输入过了多久，
+// 不够阈值就按剩余时间重挂，够了发出一次 idle() 并停止。输入事件本身从不触碰定时器。
+// Windows 下用 GetLastInputInfo 读系统级的最近输入时刻（包括在白板等其他程序里的操作）；
+// 其他平台退回到应用级事件过滤器，事件到来时只记一个时间戳，且只在监测期间安装。
+class IdleMonitor : public QObject {
+    Q_OBJECT
+public:
+    static IdleMonitor& instance();
+
+    // 从调用时刻起计时；已在监测同一阈值时不重置。
+    void start(qint64 thresholdMs);
+    void stop();
+    bool isRunning() const { return m_timer != 0; }
+    // 距最近一次输入的毫秒数，不早于 start() 的时刻。
+    qint64 idleMs() const;
+    static bool hasSystemIdleTime();
+
+signals:
+    void idle();
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    IdleMonitor();
+    void check();
+    void arm(qint64 delayMs);
+
+    QElapsedTimer m_clock;
+    qint64 m_lastInputMs = 0;
+    qint64 m_startedMs = 0;
+    qint64 m_thresholdMs = 0;
+    quint64 m_timer = 0;
+    bool m_filterInstalled = false;
+};
@@ -0,0 +1,87 @@
+#include "PairHistory.h"
+
+#include "Utils.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QHash>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+namespace {
+constexpr quint32 kPairMagic = 0x43465048;  // "CFPH"
+constexpr quint32 kPairVersion = 1;
+}
+
+PairHistory::PairHistory(int size) : m_size(size), m_cells(int((qint64(size) * (size - 1) / 2 + 1) / 2), '\0') {}
+
+QString PairHistory::pathFor(const QString& classKey) {
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/pairhistory";
+    QDir().mkpath(dir);
+    return dir + "/" + (classKey.isEmpty() ? QStringLiteral("default") : classKey) + ".bin";
+}
+
+void PairHistory::increment(StudentId a, StudentId b) {
+    if (a == b) return;
+    const qint64 i = index(a, b);
+    const int shift = int(i & 1) * 4;
+    char& cell = m_cells[int(i >> 1)];
+    const int value = (uchar(cell) >> shift) & 0xF;
+    if (value < kMaxCount) cell = char(uchar(cell) + (1 << shift));
+}
+
+void PairHistory::record(const QVector<QVector<StudentId>>& groups) {
+    for (const QVector<StudentId>& group : groups) {
+        for (int i = 0; i < group.size(); ++i) {
+            for (int j = i + 1; j < group.size(); ++j) increment(group.at(i), group.at(j));
+        }
+    }
+}
+
+PairHistory PairHistory::load(const QString& classKey, const Roster& roster) {
+    PairHistory history(roster.size());
+    QFile file(pathFor(classKey));
+    if (!file.open(QIODevice::ReadOnly)) return history;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_12);
+    quint32 magic = 0;
+    quint32 version = 0;
+    QStringList keys;
+    PairHistory stored;
+    in >> magic >> version >> keys >> stored.m_cells;
+    stored.m_size = keys.size();
+    if (in.status() != QDataStream::Ok || magic != kPairMagic || version != kPairVersion
+        || stored.m_cells.size() != PairHistory(stored.m_size).m_cells.size()) {
+        Logger::instance().warn("分组历史文件无法识别，已重新开始记录");
+        return history;
+    }
+    if (keys == roster.keys(roster.allSet())) return stored;
+
+    // 名单有增删时按学生键映射旧编号，重名学生各自保留历史，新同学从零开始。
+    const QHash<QString, StudentId> current = roster.keyIndex();
+    QVector<StudentId> map(keys.size(), -1);
+    for (int i = 0; i < keys.size(); ++i) map[i] = current.value(keys.at(i), -1);
+    for (int b = 1; b < keys.size(); ++b) {
+        if (map.at(b) < 0) continue;
+        for (int a = 0; a < b; ++a) {
+            if (map.at(a) < 0) continue;
+            for (int c = stored.count(a, b); c > 0; --c) history.increment(map.at(a), map.at(b));
+        }
+    }
+    return history;
+}
+
+bool PairHistory::save(const QString& classKey, const Roster& roster) const {
+    if (roster.size() != m_size) return false;
+    QSaveFile file(pathFor(classKey));
+    if (!file.open(QIODevice::WriteOnly)) {
+        Logger::instance().warn(QString("分组历史写入失败：%1").arg(file.errorString()));
+        return false;
+    }
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_12);
+    out << kPairMagic << kPairVersion << roster.keys(roster.allSet()) << m_cells;
+    return out.status() == QDataStream::Ok && file.commit();
+}
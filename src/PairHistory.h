@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Roster.h"
+
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+
+#include <utility>
+
+// 同组历史：每对学生一个 4 位饱和计数（上三角，两对共用一个字节），2000 人约 1MB。
+// 按班级存为 pairhistory/<班级>.bin，连同当时的学生键（见 Roster::keys）一起保存，名单变动后按键重新对齐。
+class PairHistory {
+public:
+    static constexpr int kMaxCount = 15;
+
+    PairHistory() = default;
+    explicit PairHistory(int size);
+
+    static PairHistory load(const QString& classKey, const Roster& roster);
+    bool save(const QString& classKey, const Roster& roster) const;
+
+    int size() const { return m_size; }
+    int count(StudentId a, StudentId b) const {
+        if (a == b) return 0;
+        const qint64 i = index(a, b);
+        return (uchar(m_cells.at(int(i >> 1))) >> ((i & 1) * 4)) & 0xF;
+    }
+    void increment(StudentId a, StudentId b);
+    void record(const QVector<QVector<StudentId>>& groups);
+
+private:
+    static qint64 index(StudentId a, StudentId b) {
+        if (a > b) std::swap(a, b);
+        return qint64(b) * (b - 1) / 2 + a;
+    }
+    static QString pathFor(const QString& classKey);
+
+    int m_size = 0;
+    QByteArray m_cells;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <QChar>
+
+// 内置拼音表，覆盖 CJK 基本区全部汉字，每字一个默认读音。
+namespace Pinyin {
+constexpr ushort kFirstHan = 0x4E00;
+constexpr ushort kLastHan = 0x9FA5;
+
+int syllableIndex(QChar c);
+const char* syllableText(int index);
+}
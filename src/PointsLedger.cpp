@@ -0,0 +1,464 @@
+#include "PointsLedger.h"
+
+#include "Utils.h"
+#include "Xlsx.h"
+
+#include <QDate>
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+
+#include <algorithm>
+
+#ifdef Q_OS_WIN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr quint32 kRecordMagic = 0x4C504643;  // "CFPL"
+constexpr int kHeaderSize = 12;              // magic + 负载长度 + CRC
+constexpr char kSubjectTag = 'S';
+constexpr char kEventTag = 'E';
+constexpr int kEventHeaderSize = 10;  // 标记 + 秒级时间戳 + 分值 + 来源 + 主体个数
+constexpr quint32 kMaxSubjects = 1u << 24;
+constexpr int kMaxDelta = 1000;
+
+quint16 readU16(const uchar* p) {
+    return quint16(p[0] | (p[1] << 8));
+}
+
+quint32 readU32(const uchar* p) {
+    return quint32(p[0]) | (quint32(p[1]) << 8) | (quint32(p[2]) << 16) | (quint32(p[3]) << 24);
+}
+
+void writeU16(QByteArray& out, quint16 v) {
+    out.append(char(v & 0xFF));
+    out.append(char(v >> 8));
+}
+
+void writeU32(QByteArray& out, quint32 v) {
+    for (int i = 0; i < 4; ++i) out.append(char((v >> (8 * i)) & 0xFF));
+}
+
+void writeText(QByteArray& out, const QString& text) {
+    QByteArray utf8 = text.toUtf8();
+    if (utf8.size() > 0xFFFF) {
+        // 退到字符边界再截断，不留下半个 UTF-8 字符。
+        int cut = 0xFFFF;
+        while (cut > 0 && (uchar(utf8.at(cut)) & 0xC0) == 0x80) --cut;
+        utf8.truncate(cut);
+    }
+    writeU16(out, quint16(utf8.size()));
+    out.append(utf8);
+}
+
+void appendRecord(QByteArray& out, const QByteArray& payload) {
+    writeU32(out, kRecordMagic);
+    writeU32(out, quint32(payload.size()));
+    writeU32(out, Xlsx::crc32(0, payload.constData(), payload.size()));
+    out.append(payload);
+}
+
+// 主体负载：标记、类型、主体编号、班级、姓名。编号写明在记录里，跳过损坏记录后其余编号不会错位。
+QByteArray subjectPayload(PointsLedger::Kind kind, quint32 subject, const QString& classKey, const QString& name) {
+    QByteArray payload;
+    payload.append(kSubjectTag);
+    payload.append(char(kind));
+    writeU32(payload, subject);
+    writeText(payload, classKey);
+    writeText(payload, name);
+    return payload;
+}
+
+// 事件负载：标记、时间、分值、来源和同一次加分涉及的全部主体编号。
+QByteArray eventPayload(quint32 secs, int delta, PointsLedger::Source source, const QVector<quint32>& subjects) {
+    QByteArray payload;
+    payload.reserve(kEventHeaderSize + 4 * subjects.size());
+    payload.append(kEventTag);
+    writeU32(payload, secs);
+    writeU16(payload, quint16(qint16(delta)));
+    payload.append(char(source));
+    writeU16(payload, quint16(subjects.size()));
+    for (const quint32 subject : subjects) writeU32(payload, subject);
+    return payload;
+}
+
+bool syncToDisk(QFile& file) {
+    if (!file.flush()) return false;
+#ifdef Q_OS_WIN
+    return FlushFileBuffers(reinterpret_cast<HANDLE>(_get_osfhandle(file.handle()))) != 0;
+#else
+    return ::fsync(file.handle()) == 0;
+#endif
+}
+
+// 儒略日 0 是星期一，整除 7 即得到以周一为起点的周序号。
+int weekOf(const QDate& date) {
+    return int(date.toJulianDay() / 7);
+}
+
+// 加载时事件基本按时间排列，缓存当天的起止秒数，避免逐条做时区换算。
+class WeekCache {
+public:
+    int weekOf(qint64 secs) {
+        if (secs < m_dayStart || secs >= m_dayEnd) {
+            const QDate date = QDateTime::fromSecsSinceEpoch(secs).date();
+            m_dayStart = QDateTime(date, QTime(0, 0)).toSecsSinceEpoch();
+            m_dayEnd = QDateTime(date.addDays(1), QTime(0, 0)).toSecsSinceEpoch();
+            m_week = ::weekOf(date);
+        }
+        return m_week;
+    }
+
+private:
+    qint64 m_dayStart = 0;
+    qint64 m_dayEnd = 0;
+    int m_week = 0;
+};
+}  // namespace
+
+PointsLedger& PointsLedger::instance() {
+    static PointsLedger ledger([]() {
+        const QString dataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+        QDir().mkpath(dataPath);
+        return dataPath + "/points.log";
+    }());
+    return ledger;
+}
+
+PointsLedger::PointsLedger(const QString& path) : m_path(path), m_file(path) {
+    load();
+}
+
+void PointsLedger::load() {
+    if (!m_file.open(QIODevice::ReadWrite)) {
+        Logger::instance().warn(QString("积分记录打开失败：%1").arg(m_file.errorString()));
+        return;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    const qint64 size = m_file.size();
+    uchar* data = size > 0 ? m_file.map(0, size) : nullptr;
+    QByteArray fallback;
+    if (!data && size > 0) {
+        fallback = m_file.readAll();
+        data = reinterpret_cast<uchar*>(fallback.data());
+    }
+
+    // 偏移处是一条校验通过的记录时返回负载长度，否则返回 -1。
+    const auto recordAt = [&](qint64 at) -> qint64 {
+        const uchar* h = data + at;
+        if (readU32(h) != kRecordMagic) return -1;
+        const qint64 length = readU32(h + 4);
+        if (length < 1 || at + kHeaderSize + length > size
+            || Xlsx::crc32(0, reinterpret_cast<const char*>(h + kHeaderSize), length) != readU32(h + 8)) {
+            return -1;
+        }
+        return length;
+    };
+
+    WeekCache weeks;
+    int events = 0;
+    int orphans = 0;
+    const auto applyRecord = [&](const uchar* p, qint64 length) {
+        const uchar* stop = p + length;
+        const auto readText = [&](QString* out) {
+            if (stop - p < 2) return false;
+            const int len = readU16(p);
+            p += 2;
+            if (stop - p < len) return false;
+            *out = QString::fromUtf8(reinterpret_cast<const char*>(p), len);
+            p += len;
+            return true;
+        };
+
+        if (p[0] == kSubjectTag) {
+            if (length < 6) return false;
+            const auto kind = Kind(p[1]);
+            const quint32 subject = readU32(p + 2);
+            p += 6;
+            QString classKey;
+            QString name;
+            if (!readText(&classKey) || !readText(&name) || p != stop || subject >= kMaxSubjects) return false;
+            if (subject >= quint32(m_subjects.size())) m_subjects.resize(int(subject) + 1);
+            if (!m_subjects.at(int(subject)).board) {
+                Board& b = board(classKey, kind);
+                m_subjects[int(subject)] = {&b, addMember(b, name, subject)};
+            }
+            return true;
+        }
+        if (p[0] == kEventTag) {
+            if (length < kEventHeaderSize) return false;
+            const int week = weeks.weekOf(readU32(p + 1));
+            const int delta = qint16(readU16(p + 5));
+            const int count = readU16(p + 8);
+            if (length != kEventHeaderSize + 4 * qint64(count)) return false;
+            for (int i = 0; i < count; ++i) {
+                const quint32 subject = readU32(p + kEventHeaderSize + 4 * i);
+                if (subject < quint32(m_subjects.size()) && m_subjects.at(int(subject)).board) {
+                    const Subject& s = m_subjects.at(int(subject));
+                    apply(*s.board, s.member, delta, week);
+                    ++events;
+                } else {
+                    // 主体定义落在损坏区域里：丢弃这条加分，并占住编号，新主体不会复用它。
+                    if (subject < kMaxSubjects && subject >= quint32(m_subjects.size())) m_subjects.resize(int(subject) + 1);
+                    ++orphans;
+                }
+            }
+            return true;
+        }
+        return false;
+    };
+
+    // 中间某条记录损坏时向后找到下一条完整记录继续，只有其后再没有完整记录才视为残缺尾部。
+    qint64 offset = 0;
+    qint64 end = 0;
+    qint64 skipped = 0;
+    while (offset + kHeaderSize <= size) {
+        const qint64 length = recordAt(offset);
+        if (length < 0) {
+            qint64 next = offset + 1;
+            while (next + kHeaderSize <= size && recordAt(next) < 0) ++next;
+            if (next + kHeaderSize > size) break;
+            skipped += next - offset;
+            offset = next;
+            continue;
+        }
+        if (!applyRecord(data + offset + kHeaderSize, length)) skipped += kHeaderSize + length;
+        offset += kHeaderSize + length;
+        end = offset;
+    }
+
+    // 断电后文件尾部可能是半条记录或一段补零；补零直接截断，其余内容先整份备份，可人工恢复。
+    const bool zeroTail = std::all_of(data + end, data + size, [](uchar c) { return c == 0; });
+    if (data && fallback.isEmpty()) m_file.unmap(data);
+    if (skipped > 0) {
+        Logger::instance().warn(QString("积分记录中有 %1 字节损坏，已跳过，之后的记录照常读取").arg(skipped));
+    }
+    if (orphans > 0) {
+        Logger::instance().warn(QString("积分记录中有 %1 条加分找不到对应的学生或队伍，已忽略").arg(orphans));
+    }
+    if (end < size && !zeroTail) {
+        const QString backup = m_path + ".damaged-" + QDateTime::currentDateTime().toString("yyyyMMddHHmmss");
+        if (!QFile::copy(m_path, backup)) {
+            Logger::instance().error(QString("积分记录尾部 %1 字节不完整且无法备份，本次以只读方式使用").arg(size - end));
+            m_file.close();
+        } else {
+            Logger::instance().warn(QString("积分记录尾部 %1 字节不完整，已备份到 %2 后截断")
+                                        .arg(size - end)
+                                        .arg(QFileInfo(backup).fileName()));
+            m_file.resize(end);
+        }
+    } else if (end < size) {
+        Logger::instance().warn(QString("积分记录尾部 %1 字节不完整，已截断").arg(size - end));
+        m_file.resize(end);
+    }
+    m_size = end;
+    Logger::instance().info(QString("积分记录加载：%1 条事件，%2 个主体，耗时 %3 ms")
+                                .arg(events)
+                                .arg(m_subjects.size())
+                                .arg(timer.nsecsElapsed() / 1e6, 0, 'f', 2));
+}
+
+PointsLedger::Board& PointsLedger::board(const QString& classKey, Kind kind) {
+    std::shared_ptr<Board>& slot = m_boards[qMakePair(classKey, int(kind))];
+    if (!slot) slot = std::make_shared<Board>();
+    return *slot;
+}
+
+const PointsLedger::Board* PointsLedger::findBoard(const QString& classKey, Kind kind) const {
+    const auto it = m_boards.constFind(qMakePair(classKey, int(kind)));
+    return it == m_boards.constEnd() ? nullptr : it->get();
+}
+
+int PointsLedger::addMember(Board& b, const QString& name, quint32 subject) {
+    const auto existing = b.members.constFind(name);
+    if (existing != b.members.constEnd()) return *existing;
+
+    const int member = b.names.size();
+    b.members.insert(name, member);
+    b.names.append(name);
+    b.subjects.append(subject);
+    b.weekly.append({});
+    b.total.resize(member + 1);
+    b.week.resize(member + 1);
+    return member;
+}
+
+void PointsLedger::apply(Board& b, int member, int delta, int week) {
+    b.total.setScore(member, b.total.score(member) + delta);
+    int& weekly = b.weekly[member][week];
+    weekly += delta;
+    if (week == b.currentWeek) b.week.setScore(member, weekly);
+}
+
+// 跨周后按新一周的分数重建周榜，每周只发生一次。
+void PointsLedger::syncWeek(Board& b) {
+    const int week = weekOf(QDate::currentDate());
+    if (b.currentWeek == week) return;
+    b.currentWeek = week;
+    for (int member = 0; member < b.names.size(); ++member) {
+        b.week.setScore(member, b.weekly.at(member).value(week));
+    }
+}
+
+bool PointsLedger::award(const QString& classKey, Kind kind, const QStringList& names, int delta, Source source) {
+    if (!m_file.isOpen() || names.isEmpty() || names.size() > 0xFFFF || delta == 0) return false;
+    delta = qBound(-kMaxDelta, delta, kMaxDelta);
+    Board& b = board(classKey, kind);
+    syncWeek(b);
+
+    // 新出现的学生或队伍先写主体记录，和本次加分一起写入、一起落盘。
+    QByteArray record;
+    QVector<quint32> subjects;
+    QHash<QString, quint32> added;
+    subjects.reserve(names.size());
+    for (const QString& name : names) {
+        const int member = b.members.value(name, -1);
+        if (member >= 0) {
+            subjects.append(b.subjects.at(member));
+            continue;
+        }
+        auto pending = added.constFind(name);
+        if (pending == added.constEnd()) {
+            const quint32 subject = quint32(m_subjects.size() + added.size());
+            appendRecord(record, subjectPayload(kind, subject, classKey, name));
+            pending = added.insert(name, subject);
+        }
+        subjects.append(*pending);
+    }
+    appendRecord(record, eventPayload(quint32(QDateTime::currentSecsSinceEpoch()), delta, source, subjects));
+
+    if (!m_file.seek(m_size) || m_file.write(record) != record.size() || !syncToDisk(m_file)) {
+        Logger::instance().warn(QString("积分记录写入失败：%1").arg(m_file.errorString()));
+        m_file.resize(m_size);
+        return false;
+    }
+    m_size += record.size();
+
+    m_subjects.resize(m_subjects.size() + added.size());
+    for (auto it = added.cbegin(); it != added.cend(); ++it) {
+        m_subjects[int(it.value())] = {&b, addMember(b, it.key(), it.value())};
+    }
+    const int week = weekOf(QDate::currentDate());
+    for (const quint32 subject : subjects) apply(b, m_subjects.at(int(subject)).member, delta, week);
+    return true;
+}
+
+int PointsLedger::points(const QString& classKey, Kind kind, const QString& name) const {
+    const Board* b = findBoard(classKey, kind);
+    if (!b) return 0;
+    const int member = b->members.value(name, -1);
+    return member < 0 ? 0 : b->total.score(member);
+}
+
+int PointsLedger::weekPoints(const QString& classKey, Kind kind, const QString& name) const {
+    const Board* b = findBoard(classKey, kind);
+    if (!b) return 0;
+    const int member = b->members.value(name, -1);
+    return member < 0 ? 0 : b->weekly.at(member).value(weekOf(QDate::currentDate()));
+}
+
+int PointsLedger::rank(const QString& classKey, Kind kind, const QString& name, bool thisWeek) {
+    if (!findBoard(classKey, kind)) return 0;
+    Board& b = board(classKey, kind);
+    const int member = b.members.value(name, -1);
+    if (member < 0) return 0;
+    if (!thisWeek) return b.total.rank(member);
+    syncWeek(b);
+    return b.week.rank(member);
+}
+
+QVector<PointsLedger::Standing> PointsLedger::top(const QString& classKey, Kind kind, int count, bool thisWeek) {
+    QVector<Standing> out;
+    if (!findBoard(classKey, kind)) return out;
+    Board& b = board(classKey, kind);
+    if (thisWeek) syncWeek(b);
+    const RankTree& tree = thisWeek ? b.week : b.total;
+
+    QVector<int> members;
+    tree.top(count, &members);
+    out.reserve(members.size());
+    for (const int member : members) {
+        // 排在前面的并列者已经算出名次，同分直接沿用，不必再查树。
+        const int points = tree.score(member);
+        const int rank = !out.isEmpty() && out.last().points == points ? out.last().rank : out.size() + 1;
+        out.append({b.names.at(member), points, rank});
+    }
+    return out;
+}
+
+void PointsLedger::benchmark(int students, int events) {
+    QTemporaryDir dir;
+    if (!dir.isValid()) return;
+    const QString path = dir.filePath("points.log");
+    QStringList names;
+    for (int i = 0; i < students; ++i) names.append(QString("学生%1").arg(i + 1));
+
+    // 历史事件按文件格式直接生成；award() 每次都要落盘，只用它测最后一段的真实写入速度。
+    Rng rng(Rng::session().seed());
+    {
+        QFile file(path);
+        if (!file.open(QIODevice::WriteOnly)) return;
+        QByteArray out;
+        for (int i = 0; i < students; ++i) {
+            appendRecord(out, subjectPayload(Kind::Student, quint32(i), "bench", names.at(i)));
+        }
+        const quint32 now = quint32(QDateTime::currentSecsSinceEpoch());
+        for (int i = 0; i < events; ++i) {
+            const int delta = rng.bounded(4) == 0 ? -1 : 1 + rng.bounded(3);
+            const quint32 secs = now - quint32(rng.bounded(120 * 86400));
+            appendRecord(out, eventPayload(secs, delta, Source::Manual, {quint32(rng.bounded(students))}));
+        }
+        file.write(out);
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    PointsLedger ledger(path);
+    const double loadMs = timer.nsecsElapsed() / 1e6;
+
+    const int awards = qMin(events, 200);
+    timer.restart();
+    for (int i = 0; i < awards; ++i) {
+        ledger.award("bench", Kind::Student, {names.at(rng.bounded(students))}, 1, Source::Manual);
+    }
+    const double awardSeconds = timer.nsecsElapsed() / 1e9;
+
+    const int queries = 100000;
+    qint64 checksum = 0;
+    timer.restart();
+    for (int i = 0; i < queries; ++i) {
+        checksum += ledger.rank("bench", Kind::Student, names.at(rng.bounded(students)), i & 1);
+        checksum += ledger.weekPoints("bench", Kind::Student, names.at(rng.bounded(students)));
+    }
+    const double queryUs = timer.nsecsElapsed() / 1e3 / queries;
+
+    timer.restart();
+    for (int i = 0; i < 1000; ++i) checksum += ledger.top("bench", Kind::Student, 10, i & 1).size();
+    const double topUs = timer.nsecsElapsed() / 1e3 / 1000;
+
+    Logger::instance().info(QString("积分账本基准：%1 人 %2 条事件，落盘写入 %3 条/秒，加载 %4 ms，"
+                                    "名次+本周得分 %5 us/次，前 10 名 %6 us/次，文件 %7 KB（校验 %8）")
+                                .arg(students)
+                                .arg(events)
+                                .arg(awards / qMax(awardSeconds, 1e-9), 0, 'f', 0)
+                                .arg(loadMs, 0, 'f', 2)
+                                .arg(queryUs, 0, 'f', 2)
+                                .arg(topUs, 0, 'f', 2)
+                                .arg(QFileInfo(path).size() / 1024)
+                                .arg(checksum));
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "RankTree.h"
+
+#include <QFile>
+#include <QHash>
+#include <QMap>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include <memory>
+
+// 课堂积分账本：每次加减分把新主体和事件追加为带 CRC 的记录并立即落盘，从不改写旧记录。
+// 启动时顺序扫描一次，按班级分别维护学生和队伍的累计分、每周分以及两棵名次树，
+// 之后“前 10 名”“某人名次”“本周得分”都不再回看事件。中间损坏的记录只跳过，
+// 其后的记录照常读取；文件尾部不完整的记录先备份再截断。
+class PointsLedger {
+public:
+    enum class Kind : quint8 { Student, Team };
+    enum class Source : quint8 { Manual, RandomCall, Group, ScoreBoard };
+    struct Standing {
+        QString name;
+        int points = 0;
+        int rank = 0;
+    };
+
+    static PointsLedger& instance();
+
+    bool award(const QString& classKey, Kind kind, const QStringList& names, int delta, Source source);
+    int points(const QString& classKey, Kind kind, const QString& name) const;
+    int weekPoints(const QString& classKey, Kind kind, const QString& name) const;
+    // 名次从 1 开始，同分并列；没有记录返回 0。
+    int rank(const QString& classKey, Kind kind, const QString& name, bool thisWeek = false);
+    QVector<Standing> top(const QString& classKey, Kind kind, int count, bool thisWeek = false);
+
+    static void benchmark(int students, int events);
+
+private:
+    struct Board {
+        QHash<QString, int> members;
+        QStringList names;
+        QVector<quint32> subjects;       // 成员 → 文件中的主体编号
+        QVector<QMap<int, int>> weekly;  // 成员 → 周序号 → 当周得分
+        RankTree total;
+        RankTree week;
+        int currentWeek = -1;
+    };
+    struct Subject {
+        Board* board = nullptr;  // 定义记录损坏丢失的编号为空
+        int member = -1;
+    };
+
+    explicit PointsLedger(const QString& path);
+    void load();
+    Board& board(const QString& classKey, Kind kind);
+    const Board* findBoard(const QString& classKey, Kind kind) const;
+    int addMember(Board& board, const QString& name, quint32 subject);
+    void apply(Board& board, int member, int delta, int week);
+    void syncWeek(Board& board);
+
+    QString m_path;
+    QFile m_file;
+    qint64 m_size = 0;
+    // Board 存放在堆上，Subject 里的指针在哈希表扩容后依然有效。
+    QHash<QPair<QString, int>, std::shared_ptr<Board>> m_boards;
+    QVector<Subject> m_subjects;
+};
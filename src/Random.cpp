@@ -0,0 +1,39 @@
+#include "Random.h"
+
+#include "Utils.h"
+
+#include <QRandomGenerator>
+
+void Rng::reseed(quint64 seed) {
+    m_seed = seed;
+    quint64 x = seed;
+    for (quint64& s : m_s) {
+        x += 0x9E3779B97F4A7C15ull;
+        quint64 z = x;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        s = z ^ (z >> 31);
+    }
+}
+
+Rng& Rng::session() {
+    static Rng rng(QRandomGenerator::system()->generate64());
+    return rng;
+}
+
+bool Rng::parseSeed(const QStringList& arguments, quint64* seed) {
+    for (const QString& arg : arguments) {
+        if (!arg.startsWith("--seed=")) continue;
+        bool ok = false;
+        const quint64 value = arg.mid(7).toULongLong(&ok, 0);
+        if (ok) *seed = value;
+        return ok;
+    }
+    return false;
+}
+
+void Rng::initSession(const QStringList& arguments) {
+    quint64 seed = 0;
+    if (parseSeed(arguments, &seed)) session().reseed(seed);
+    Logger::instance().info(QString("本次会话随机种子：%1").arg(session().seed()));
+}
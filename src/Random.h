@@ -0,0 +1,62 @@
+#pragma once
+
+#include <QStringList>
+#include <QVector>
+#include <QtGlobal>
+
+#include <utility>
+
+// 点名与分组共用的伪随机数发生器：xoshiro256**，种子经 splitmix64 展开。
+// 同一种子得到完全相同的序列，便于复现和审计；只在 UI 线程使用，不加锁。
+class Rng {
+public:
+    explicit Rng(quint64 seed = 0) { reseed(seed); }
+
+    void reseed(quint64 seed);
+    quint64 seed() const { return m_seed; }
+
+    quint64 next() {
+        const quint64 result = rotl(m_s[1] * 5, 7) * 9;
+        const quint64 t = m_s[1] << 17;
+        m_s[2] ^= m_s[0];
+        m_s[3] ^= m_s[1];
+        m_s[1] ^= m_s[2];
+        m_s[0] ^= m_s[3];
+        m_s[2] ^= t;
+        m_s[3] = rotl(m_s[3], 45);
+        return result;
+    }
+
+    // Lemire 乘法取高位法，只在极少数情况下拒绝重抽，结果在 [0, bound) 内严格均匀。
+    quint32 bounded(quint32 bound) {
+        quint64 m = quint64(quint32(next() >> 32)) * bound;
+        quint32 low = quint32(m);
+        if (low < bound) {
+            const quint32 threshold = (0u - bound) % bound;
+            while (low < threshold) {
+                m = quint64(quint32(next() >> 32)) * bound;
+                low = quint32(m);
+            }
+        }
+        return quint32(m >> 32);
+    }
+    int bounded(int bound) { return bound > 0 ? int(bounded(quint32(bound))) : 0; }
+
+    double generateDouble() { return double(next() >> 11) * (1.0 / 9007199254740992.0); }
+
+    template <typename T>
+    void shuffle(QVector<T>& values) {
+        for (int i = values.size() - 1; i > 0; --i) std::swap(values[i], values[bounded(i + 1)]);
+    }
+
+    // 会话发生器：启动时确定种子并写入日志，命令行 --seed=N 可指定种子复现一次课堂。
+    static Rng& session();
+    static void initSession(const QStringList& arguments);
+    static bool parseSeed(const QStringList& arguments, quint64* seed);
+
+private:
+    static quint64 rotl(quint64 x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    quint64 m_seed = 0;
+    quint64 m_s[4] = {};
+};
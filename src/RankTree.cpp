@@ -0,0 +1,123 @@
+#include "RankTree.h"
+
+void RankTree::resize(int count) {
+    const int old = m_nodes.size();
+    if (count <= old) return;
+    m_nodes.resize(count);
+    for (int id = old; id < count; ++id) {
+        Node& node = m_nodes[id];
+        node.priority = quint32(m_rng.next() >> 32);
+        int left = -1;
+        int right = -1;
+        split(m_root, id, &left, &right);
+        m_root = merge(merge(left, id), right);
+    }
+}
+
+void RankTree::setScore(int id, int score) {
+    if (m_nodes.at(id).score == score) return;
+    int left = -1;
+    int right = -1;
+    split(m_root, id, &left, &right);
+    right = removeFirst(right);
+    Node& node = m_nodes[id];
+    node.score = score;
+    node.left = -1;
+    node.right = -1;
+    node.count = 1;
+    m_root = merge(left, right);
+    split(m_root, id, &left, &right);
+    m_root = merge(merge(left, id), right);
+}
+
+int RankTree::countAbove(int score) const {
+    int count = 0;
+    for (int t = m_root; t >= 0;) {
+        const Node& node = m_nodes.at(t);
+        if (node.score > score) {
+            count += countOf(node.left) + 1;
+            t = node.right;
+        } else {
+            t = node.left;
+        }
+    }
+    return count;
+}
+
+int RankTree::at(int position) const {
+    for (int t = m_root; t >= 0;) {
+        const Node& node = m_nodes.at(t);
+        const int leftCount = countOf(node.left);
+        if (position < leftCount) {
+            t = node.left;
+        } else if (position == leftCount) {
+            return t;
+        } else {
+            position -= leftCount + 1;
+            t = node.right;
+        }
+    }
+    return -1;
+}
+
+void RankTree::top(int count, QVector<int>* out) const {
+    out->clear();
+    // 中序遍历，取够即停；栈深度为树高。
+    QVector<int> stack;
+    int t = m_root;
+    while ((t >= 0 || !stack.isEmpty()) && out->size() < count) {
+        while (t >= 0) {
+            stack.append(t);
+            t = m_nodes.at(t).left;
+        }
+        t = stack.takeLast();
+        out->append(t);
+        t = m_nodes.at(t).right;
+    }
+}
+
+void RankTree::pull(int t) {
+    Node& node = m_nodes[t];
+    node.count = 1 + countOf(node.left) + countOf(node.right);
+}
+
+// 把排在 id 之前的节点分到 left，其余（含 id 本身）分到 right。
+void RankTree::split(int t, int id, int* left, int* right) {
+    if (t < 0) {
+        *left = -1;
+        *right = -1;
+        return;
+    }
+    if (before(t, id)) {
+        int rest = -1;
+        split(m_nodes.at(t).right, id, &rest, right);
+        m_nodes[t].right = rest;
+        *left = t;
+    } else {
+        int rest = -1;
+        split(m_nodes.at(t).left, id, left, &rest);
+        m_nodes[t].left = rest;
+        *right = t;
+    }
+    pull(t);
+}
+
+int RankTree::merge(int a, int b) {
+    if (a < 0) return b;
+    if (b < 0) return a;
+    if (m_nodes.at(a).priority > m_nodes.at(b).priority) {
+        m_nodes[a].right = merge(m_nodes.at(a).right, b);
+        pull(a);
+        return a;
+    }
+    m_nodes[b].left = merge(a, m_nodes.at(b).left);
+    pull(b);
+    return b;
+}
+
+int RankTree::removeFirst(int t) {
+    if (m_nodes.at(t).left < 0) return m_nodes.at(t).right;
+    m_nodes[t].left = removeFirst(m_nodes.at(t).left);
+    pull(t);
+    return t;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Random.h"
+
+#include <QVector>
+
+// 名次树：按分数降序（同分按编号升序）排列、带子树大小的 treap。
+// 成员编号就是节点下标，改分、查名次、取第 k 名都是 O(log n)，取前 k 名 O(log n + k)。
+class RankTree {
+public:
+    // 新增的成员以 0 分加入。
+    void resize(int count);
+    int size() const { return m_nodes.size(); }
+    int score(int id) const { return m_nodes.at(id).score; }
+    void setScore(int id, int score);
+
+    // 分数严格高于 score 的人数；同分并列，名次 = countAbove + 1。
+    int countAbove(int score) const;
+    int rank(int id) const { return countAbove(score(id)) + 1; }
+    int at(int position) const;
+    void top(int count, QVector<int>* out) const;
+
+private:
+    struct Node {
+        int score = 0;
+        quint32 priority = 0;
+        int left = -1;
+        int right = -1;
+        int count = 1;
+    };
+
+    bool before(int a, int b) const {
+        const Node& x = m_nodes.at(a);
+        const Node& y = m_nodes.at(b);
+        return x.score != y.score ? x.score > y.score : a < b;
+    }
+    int countOf(int t) const { return t < 0 ? 0 : m_nodes.at(t).count; }
+    void pull(int t);
+    void split(int t, int id, int* left, int* right);
+    int merge(int a, int b);
+    int removeFirst(int t);
+
+    QVector<Node> m_nodes;
+    int m_root = -1;
+    Rng m_rng{0x5eed5eedULL};
+};
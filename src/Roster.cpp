@@ -0,0 +1,156 @@
+#include "Roster.h"
+
+#include <QHash>
+#include <QJsonObject>
+
+namespace {
+Roster::Gender parseGender(const QString& text) {
+    const QString t = text.trimmed().toLower();
+    if (t == QStringLiteral("男") || t == "m" || t == "male") return Roster::Gender::Male;
+    if (t == QStringLiteral("女") || t == "f" || t == "female") return Roster::Gender::Female;
+    return Roster::Gender::Unknown;
+}
+
+QString genderText(Roster::Gender gender) {
+    switch (gender) {
+    case Roster::Gender::Male: return QStringLiteral("男");
+    case Roster::Gender::Female: return QStringLiteral("女");
+    case Roster::Gender::Unknown: break;
+    }
+    return QString();
+}
+}  // namespace
+
+void Roster::append(const QString& name, const QString& number, Gender gender, const QString& group) {
+    m_names.append(name);
+    m_numbers.append(number);
+    m_genders.append(gender);
+    m_groups.append(group);
+}
+
+RosterPtr Roster::fromNames(const QStringList& names) {
+    auto roster = std::make_shared<Roster>();
+    roster->m_names.reserve(names.size());
+    for (const QString& s : names) {
+        const QString name = s.trimmed();
+        if (!name.isEmpty()) roster->append(name);
+    }
+    return roster;
+}
+
+RosterPtr Roster::fromJson(const QJsonArray& array) {
+    auto roster = std::make_shared<Roster>();
+    roster->m_names.reserve(array.size());
+    for (const auto& v : array) {
+        if (v.isObject()) {
+            const QJsonObject o = v.toObject();
+            const QString name = o.value(QLatin1String("name")).toString().trimmed();
+            if (name.isEmpty()) continue;
+            roster->append(name,
+                           o.value(QLatin1String("number")).toString().trimmed(),
+                           parseGender(o.value(QLatin1String("gender")).toString()),
+                           o.value(QLatin1String("group")).toString().trimmed());
+        } else {
+            const QString name = v.toString().trimmed();
+            if (!name.isEmpty()) roster->append(name);
+        }
+    }
+    return roster;
+}
+
+RosterPtr Roster::withNames(const QStringList& names) const {
+    const QHash<QString, StudentId> existing = keyIndex();
+    QHash<QString, int> seen;
+
+    auto roster = std::make_shared<Roster>();
+    roster->m_names.reserve(names.size());
+    for (const QString& s : names) {
+        const QString name = s.trimmed();
+        if (name.isEmpty()) continue;
+        const int k = ++seen[name];
+        const StudentId id = existing.value(k == 1 ? name : name + '#' + QString::number(k), -1);
+        if (id >= 0 && m_names.at(id) == name) {
+            roster->append(name, m_numbers.at(id), m_genders.at(id), m_groups.at(id));
+        } else {
+            roster->append(name);
+        }
+    }
+    return roster;
+}
+
+// 没有附加属性的学生仍写成字符串，旧版本读取新配置时名单不受影响。
+QJsonArray Roster::toJson() const {
+    QJsonArray array;
+    for (StudentId id = 0; id < size(); ++id) {
+        if (m_numbers.at(id).isEmpty() && m_genders.at(id) == Gender::Unknown && m_groups.at(id).isEmpty()) {
+            array.append(m_names.at(id));
+            continue;
+        }
+        QJsonObject o;
+        o["name"] = m_names.at(id);
+        if (!m_numbers.at(id).isEmpty()) o["number"] = m_numbers.at(id);
+        if (m_genders.at(id) != Gender::Unknown) o["gender"] = genderText(m_genders.at(id));
+        if (!m_groups.at(id).isEmpty()) o["group"] = m_groups.at(id);
+        array.append(o);
+    }
+    return array;
+}
+
+QStringList Roster::names(const StudentSet& set) const {
+    QStringList out;
+    set.forEach([&](StudentId id) {
+        if (id < size()) out.append(m_names.at(id));
+    });
+    return out;
+}
+
+QVector<int> Roster::occurrences() const {
+    QVector<int> out(size());
+    QHash<QString, int> seen;
+    seen.reserve(size());
+    for (StudentId id = 0; id < size(); ++id) out[id] = ++seen[m_names.at(id)];
+    return out;
+}
+
+QStringList Roster::keys(const StudentSet& set) const {
+    if (set.isEmpty()) return {};
+    const QVector<int> occ = occurrences();
+    QStringList out;
+    set.forEach([&](StudentId id) {
+        if (id >= size()) return;
+        out.append(occ.at(id) == 1 ? m_names.at(id) : m_names.at(id) + '#' + QString::number(occ.at(id)));
+    });
+    return out;
+}
+
+QHash<QString, StudentId> Roster::keyIndex() const {
+    const QVector<int> occ = occurrences();
+    QHash<QString, StudentId> index;
+    index.reserve(size());
+    // 先登记真实姓名，名单里恰好有人叫“某某#2”时以真名为准。
+    for (StudentId id = 0; id < size(); ++id) {
+        if (occ.at(id) == 1) index.insert(m_names.at(id), id);
+    }
+    for (StudentId id = 0; id < size(); ++id) {
+        if (occ.at(id) == 1) continue;
+        const QString key = m_names.at(id) + '#' + QString::number(occ.at(id));
+        if (!index.contains(key)) index.insert(key, id);
+    }
+    return index;
+}
+
+StudentSet Roster::setOf(const QStringList& keys) const {
+    if (keys.isEmpty()) return emptySet();
+    return setOf(keys, keyIndex());
+}
+
+StudentSet Roster::setOf(const QStringList& keys, const QHash<QString, StudentId>& index) const {
+    StudentSet set = emptySet();
+    for (const QString& key : keys) set.insert(index.value(key, -1));
+    return set;
+}
+
+bool Roster::operator==(const Roster& other) const {
+    return m_names == other.m_names && m_numbers == other.m_numbers && m_genders == other.m_genders
+        && m_groups == other.m_groups;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <QHash>
+#include <QJsonArray>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QtAlgorithms>
+
+#include <memory>
+
+using StudentId = int;
+
+// 以学生 ID 为下标的位集合，缺勤、已点名等选择状态都用它表示，重名学生互不影响。
+class StudentSet {
+public:
+    explicit StudentSet(int size = 0) : m_size(size), m_words((size + 63) / 64, 0) {}
+
+    int size() const { return m_size; }
+    bool contains(StudentId id) const {
+        return id >= 0 && id < m_size && (m_words[id >> 6] >> (id & 63)) & 1;
+    }
+    void insert(StudentId id) {
+        if (id >= 0 && id < m_size) m_words[id >> 6] |= quint64(1) << (id & 63);
+    }
+    void remove(StudentId id) {
+        if (id >= 0 && id < m_size) m_words[id >> 6] &= ~(quint64(1) << (id & 63));
+    }
+    void clear() { m_words.fill(0); }
+    void fill() {
+        m_words.fill(~quint64(0));
+        trimTail();
+    }
+
+    int count() const {
+        int n = 0;
+        for (const quint64 w : m_words) n += qPopulationCount(w);
+        return n;
+    }
+    bool isEmpty() const {
+        for (const quint64 w : m_words) {
+            if (w) return false;
+        }
+        return true;
+    }
+
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (int i = 0; i < m_words.size(); ++i) {
+            for (quint64 w = m_words[i]; w; w &= w - 1) fn(StudentId(i * 64 + qCountTrailingZeroBits(w)));
+        }
+    }
+
+    const QVector<quint64>& words() const { return m_words; }
+    bool operator==(const StudentSet& other) const { return m_size == other.m_size && m_words == other.m_words; }
+    bool operator!=(const StudentSet& other) const { return !(*this == other); }
+
+private:
+    void trimTail() {
+        if (m_size & 63) m_words.last() &= (quint64(1) << (m_size & 63)) - 1;
+    }
+
+    int m_size;
+    QVector<quint64> m_words;
+};
+
+class Roster;
+using RosterPtr = std::shared_ptr<const Roster>;
+
+// 班级名单的列式存储：学生以在名单中的位置作为稳定 ID，各属性按列保存。
+// 名单整体不可变，修改时构建新实例并随配置快照一起发布。
+class Roster {
+public:
+    enum class Gender : quint8 { Unknown, Male, Female };
+
+    static RosterPtr fromNames(const QStringList& names);
+    // students 数组元素可以是姓名字符串，也可以是 {name, number, gender, group} 对象。
+    static RosterPtr fromJson(const QJsonArray& array);
+    // 按新的姓名列表重建名单，同名学生按出现次序对应，保留原有的学号、性别与分组。
+    RosterPtr withNames(const QStringList& names) const;
+    QJsonArray toJson() const;
+
+    int size() const { return m_names.size(); }
+    bool isEmpty() const { return m_names.isEmpty(); }
+    const QStringList& names() const { return m_names; }
+    const QString& name(StudentId id) const { return m_names.at(id); }
+    const QString& number(StudentId id) const { return m_numbers.at(id); }
+    Gender gender(StudentId id) const { return m_genders.at(id); }
+    const QString& group(StudentId id) const { return m_groups.at(id); }
+
+    StudentSet emptySet() const { return StudentSet(size()); }
+    StudentSet allSet() const {
+        StudentSet set(size());
+        set.fill();
+        return set;
+    }
+    QStringList names(const StudentSet& set) const;
+
+    // 持久化用的学生键：名单中第 k 个（k ≥ 2）同名学生写成“姓名#k”，其余就是姓名本身，
+    // 重名学生保存后再读回不会合并。旧记录里的纯姓名按第一个同名学生解析。
+    QStringList keys(const StudentSet& set) const;
+    // 键 → ID 的查找表；需要连续解析多组键时建一次重复使用。
+    QHash<QString, StudentId> keyIndex() const;
+    StudentSet setOf(const QStringList& keys) const;
+    StudentSet setOf(const QStringList& keys, const QHash<QString, StudentId>& index) const;
+
+    bool operator==(const Roster& other) const;
+    bool operator!=(const Roster& other) const { return !(*this == other); }
+
+private:
+    void append(const QString& name, const QString& number = QString(), Gender gender = Gender::Unknown,
+                const QString& group = QString());
+    // 每个学生是同名者中的第几个，从 1 开始。
+    QVector<int> occurrences() const;
+
+    QStringList m_names;
+    QStringList m_numbers;
+    QVector<Gender> m_genders;
+    QStringList m_groups;
+};
@@ -0,0 +1,145 @@
+#include "RosterSearch.h"
+
+#include "Pinyin.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// 作姓氏时读音与默认读音不同的常见字。
+const char* surnameReading(QChar c) {
+    switch (c.unicode()) {
+    case 0x5355: return "shan";   // 单
+    case 0x66FE: return "zeng";   // 曾
+    case 0x89E3: return "xie";    // 解
+    case 0x4EC7: return "qiu";    // 仇
+    case 0x533A: return "ou";     // 区
+    case 0x67E5: return "zha";    // 查
+    case 0x6734: return "piao";   // 朴
+    case 0x76D6: return "ge";     // 盖
+    case 0x4E50: return "yue";    // 乐
+    case 0x7F2A: return "miao";   // 缪
+    case 0x8983: return "qin";    // 覃
+    case 0x53EC: return "shao";   // 召
+    case 0x79D8: return "bi";     // 秘
+    case 0x79CD: return "chong";  // 种
+    case 0x7FDF: return "zhai";   // 翟
+    case 0x7E41: return "po";     // 繁
+    case 0x5458: return "yun";    // 员
+    case 0x91CD: return "chong";  // 重
+    }
+    return nullptr;
+}
+
+const char* asciiSyllable(char c) {
+    static const auto table = []() {
+        QVector<QByteArray> t(128);
+        for (int i = 0; i < 128; ++i) t[i] = QByteArray(1, char(i));
+        return t;
+    }();
+    return table[c & 0x7F].constData();
+}
+
+// 从第 i 个字符起，每个字符可以消耗其拼音的任意非空前缀，直到查询串用完。
+bool matchFrom(const QVector<const char*>& syllables, int i, const QByteArray& q, int pos) {
+    if (pos == q.size()) return true;
+    if (i == syllables.size() || !syllables[i]) return false;
+    const char* s = syllables[i];
+    const int len = int(std::strlen(s));
+    for (int k = qMin(len, q.size() - pos); k >= 1; --k) {
+        if (std::memcmp(s, q.constData() + pos, size_t(k)) == 0 && matchFrom(syllables, i + 1, q, pos + k)) {
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
+RosterSearchIndex::RosterSearchIndex(const RosterPtr& roster) {
+    const int count = roster ? roster->size() : 0;
+    m_entries.reserve(count);
+    m_all.reserve(count);
+    for (StudentId id = 0; id < count; ++id) {
+        Entry entry;
+        entry.lowerName = roster->name(id).toLower();
+        entry.syllables.reserve(entry.lowerName.size());
+        QVector<QChar> keys;
+        for (const QChar c : entry.lowerName) {
+            const char* syllable = nullptr;
+            if (c.unicode() < 128 && c.isLetterOrNumber()) {
+                syllable = asciiSyllable(char(c.unicode()));
+            } else if (const int index = Pinyin::syllableIndex(c)) {
+                syllable = Pinyin::syllableText(index);
+            }
+            entry.syllables.append(syllable);
+            keys.append(c);
+            if (syllable) keys.append(QChar(syllable[0]));
+        }
+        if (!entry.lowerName.isEmpty()) {
+            entry.surname = surnameReading(entry.lowerName.at(0));
+            if (entry.surname) keys.append(QChar(entry.surname[0]));
+        }
+
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        for (const QChar key : keys) m_postings[key].append(id);
+
+        m_entries.append(entry);
+        m_all.append(id);
+    }
+}
+
+bool RosterSearchIndex::matches(const Entry& entry, const QByteArray& pinyinQuery, const QString& query) const {
+    if (entry.lowerName.contains(query)) return true;
+    if (pinyinQuery.isEmpty()) return false;
+    for (int i = 0; i < entry.syllables.size(); ++i) {
+        if (matchFrom(entry.syllables, i, pinyinQuery, 0)) return true;
+    }
+    if (entry.surname) {
+        QVector<const char*> alternate = entry.syllables;
+        alternate[0] = entry.surname;
+        return matchFrom(alternate, 0, pinyinQuery, 0);
+    }
+    return false;
+}
+
+const QVector<StudentId>& RosterSearchIndex::filter(const QString& keyword) {
+    QString query = keyword.toLower();
+    query.remove(QLatin1Char(' '));
+    query.remove(QLatin1Char('\''));
+    if (query.isEmpty()) {
+        m_lastQuery.clear();
+        m_lastResult = m_all;
+        return m_lastResult;
+    }
+    if (query == m_lastQuery) {
+        return m_lastResult;
+    }
+
+    // 查询串变长时，新结果一定是旧结果的子集；否则从首字符的倒排表重新开始。
+    const bool narrowing = !m_lastQuery.isEmpty() && query.startsWith(m_lastQuery);
+    const QVector<StudentId> candidates = narrowing ? m_lastResult : m_postings.value(query.at(0));
+    m_lastQuery = query;
+    if (query.size() == 1) {
+        m_lastResult = candidates;
+        return m_lastResult;
+    }
+
+    // 只有全为 ASCII 字母数字的查询才按拼音匹配。
+    QByteArray pinyinQuery;
+    for (const QChar c : query) {
+        if (c.unicode() >= 128 || !c.isLetterOrNumber()) {
+            pinyinQuery.clear();
+            break;
+        }
+        pinyinQuery.append(char(c.unicode()));
+    }
+
+    QVector<StudentId> result;
+    result.reserve(candidates.size());
+    for (const StudentId id : candidates) {
+        if (matches(m_entries.at(id), pinyinQuery, query)) result.append(id);
+    }
+    m_lastResult = result;
+    return m_lastResult;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#include "Roster.h"
+
+// 名单检索索引：支持汉字子串、全拼、首字母及两者混合（如 “zs”“zhangs”“zhs” 均可找到张三）。
+// 构建时为每个字符生成倒排表；查询在上一次结果的基础上继续收窄，输入越长候选越少。
+class RosterSearchIndex {
+public:
+    explicit RosterSearchIndex(const RosterPtr& roster);
+
+    const QVector<StudentId>& filter(const QString& query);
+
+private:
+    struct Entry {
+        QString lowerName;
+        QVector<const char*> syllables;  // 每个字符一项，nullptr 表示无法按拼音匹配
+        const char* surname = nullptr;   // 姓氏多音字的另一读音
+    };
+
+    bool matches(const Entry& entry, const QByteArray& pinyinQuery, const QString& query) const;
+
+    QVector<Entry> m_entries;
+    QHash<QChar, QVector<StudentId>> m_postings;
+    QVector<StudentId> m_all;
+    QString m_lastQuery;
+    QVector<StudentId> m_lastResult;
+};
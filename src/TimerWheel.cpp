@@ -0,0 +1,241 @@
+#include "TimerWheel.h"
+
+#include "Utils.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+
+namespace {
+constexpr qint64 kMaxDelayMs = qint64(1) << 35;     // 约一年，远小于时间轮跨度
+constexpr qint64 kMaxArmMs = 60 * 60 * 1000;        // QTimer 间隔为 int，过远的截止时间分段等待
+constexpr qint64 kReportIntervalMs = 30 * 60 * 1000;
+}
+
+TimerWheel& TimerWheel::instance() {
+    static TimerWheel wheel;
+    return wheel;
+}
+
+TimerWheel::TimerWheel() {
+    m_clock.start();
+    m_driver.setSingleShot(true);
+    // 粗精度定时器不会抬高系统时钟中断频率；偶尔提前醒来时 dispatch 只会重新挂起。
+    m_driver.setTimerType(Qt::CoarseTimer);
+    connect(&m_driver, &QTimer::timeout, this, &TimerWheel::dispatch);
+    if (QCoreApplication::instance()) {
+        connect(qApp, &QCoreApplication::aboutToQuit, this, [this]() { m_driver.stop(); });
+    }
+    scheduleRepeating(kReportIntervalMs, this, [this]() { reportWakeups(); }, 5 * 60 * 1000);
+}
+
+quint64 TimerWheel::schedule(qint64 delayMs, QObject* context, Callback fn, qint64 slackMs) {
+    return add(delayMs, 0, context, std::move(fn), slackMs);
+}
+
+quint64 TimerWheel::scheduleRepeating(qint64 intervalMs, QObject* context, Callback fn, qint64 slackMs) {
+    return add(intervalMs, qMax<qint64>(1, intervalMs), context, std::move(fn), slackMs);
+}
+
+qint64 TimerWheel::msecsUntil(const QDateTime& when) {
+    return qMax<qint64>(0, QDateTime::currentDateTime().msecsTo(when));
+}
+
+quint64 TimerWheel::add(qint64 delayMs, qint64 intervalMs, QObject* context, Callback fn, qint64 slackMs) {
+    const qint64 now = m_clock.elapsed();
+    if (!m_dispatching) catchUp(now);
+    const quint64 id = m_nextId++;
+    Entry& entry = m_timers[id];
+    entry.deadline = now + qBound<qint64>(0, delayMs, kMaxDelayMs);
+    entry.slack = qMax<qint64>(0, slackMs);
+    entry.fireAt = alignedFireTime(entry.deadline, entry.slack);
+    entry.interval = intervalMs;
+    entry.context = context;
+    entry.hasContext = context != nullptr;
+    entry.fn = std::move(fn);
+    insert(id, entry);
+
+    // 回调里登记的定时器由 dispatch 结束时统一挂起；挂起点已被 catchUp 越过时也重新挂起。
+    if (!m_dispatching && (m_armedAt <= m_now || entry.fireAt < m_armedAt)) arm();
+    return id;
+}
+
+void TimerWheel::cancel(quint64 id) {
+    const auto it = m_timers.find(id);
+    if (it == m_timers.end()) return;
+    if (it->level >= 0) unlink(*it);
+    m_timers.erase(it);
+    if (m_timers.isEmpty() && !m_dispatching) {
+        m_driver.stop();
+        m_armedAt = -1;
+    }
+}
+
+// 在 [deadline, deadline + slack] 内取最粗的 2 的幂边界，slack 相近的定时器会落在同一时刻。
+qint64 TimerWheel::alignedFireTime(qint64 deadline, qint64 slack) const {
+    qint64 fireAt = deadline;
+    if (slack > 0) {
+        const qint64 grain = qint64(1) << (63 - qCountLeadingZeroBits(quint64(slack + 1)));
+        fireAt = (deadline + grain - 1) / grain * grain;
+    }
+    return qMax(fireAt, m_now + 1);
+}
+
+// 层号取截止时间与当前时间第一个相同的高位段；同一层的定时器在当前槽之后，轮到该槽时再逐层下放。
+void TimerWheel::insert(quint64 id, Entry& entry) {
+    int level = 0;
+    while (level < kLevels - 1
+           && (entry.fireAt >> (kSlotBits * (level + 1))) != (m_now >> (kSlotBits * (level + 1)))) {
+        ++level;
+    }
+    const int slot = int((entry.fireAt >> (kSlotBits * level)) & (kSlots - 1));
+    QVector<quint64>& bucket = m_slots[level][slot];
+    entry.level = level;
+    entry.slot = slot;
+    entry.pos = bucket.size();
+    bucket.append(id);
+    m_occupied[level] |= quint64(1) << slot;
+}
+
+void TimerWheel::unlink(Entry& entry) {
+    QVector<quint64>& bucket = m_slots[entry.level][entry.slot];
+    const quint64 moved = bucket.last();
+    bucket[entry.pos] = moved;
+    m_timers[moved].pos = entry.pos;
+    bucket.removeLast();
+    if (bucket.isEmpty()) m_occupied[entry.level] &= ~(quint64(1) << entry.slot);
+    entry.level = -1;
+}
+
+QVector<quint64> TimerWheel::takeSlot(int level, int slot) {
+    QVector<quint64> ids;
+    ids.swap(m_slots[level][slot]);
+    m_occupied[level] &= ~(quint64(1) << slot);
+    for (const quint64 id : ids) m_timers[id].level = -1;
+    return ids;
+}
+
+qint64 TimerWheel::nextEventTime() const {
+    qint64 next = -1;
+    for (int level = 0; level < kLevels; ++level) {
+        const int shift = kSlotBits * level;
+        const int current = int((m_now >> shift) & (kSlots - 1));
+        const quint64 later = current == kSlots - 1 ? 0 : m_occupied[level] & (~quint64(0) << (current + 1));
+        if (!later) continue;
+        const qint64 base = (m_now >> (shift + kSlotBits)) << (shift + kSlotBits);
+        const qint64 at = base + (qint64(qCountTrailingZeroBits(later)) << shift);
+        if (next < 0 || at < next) next = at;
+    }
+    return next;
+}
+
+// m_now 落在高层槽边界时，把该槽的定时器下放到更低的层。
+void TimerWheel::cascade() {
+    for (int level = kLevels - 1; level > 0; --level) {
+        const int shift = kSlotBits * level;
+        if (m_now & ((qint64(1) << shift) - 1)) continue;
+        const int slot = int((m_now >> shift) & (kSlots - 1));
+        if (!(m_occupied[level] & (quint64(1) << slot))) continue;
+        for (const quint64 id : takeSlot(level, slot)) insert(id, m_timers[id]);
+    }
+}
+
+// 逐个跳到有定时器的槽，中间的空槽一概不访问。
+void TimerWheel::advance(qint64 target) {
+    for (;;) {
+        const qint64 next = nextEventTime();
+        if (next < 0 || next > target) break;
+        m_now = next;
+        cascade();
+        const int slot = int(m_now & (kSlots - 1));
+        if (m_occupied[0] & (quint64(1) << slot)) fire(takeSlot(0, slot));
+    }
+    m_now = qMax(m_now, target);
+}
+
+// 空闲期间 m_now 停在上次分发的时刻。登记前先把时间轮推进到当前时间再入轮，
+// 否则新定时器会挂在早已过去的高层槽边界上，挂起时立刻触发一次 0ms 的空唤醒。
+// 推进途中遇到已到期的定时器不在这里执行，推到下一毫秒，仍由 dispatch 触发。
+void TimerWheel::catchUp(qint64 target) {
+    QVector<quint64> due;
+    for (;;) {
+        const qint64 next = nextEventTime();
+        if (next < 0 || next > target) break;
+        m_now = next;
+        cascade();
+        const int slot = int(m_now & (kSlots - 1));
+        if (m_occupied[0] & (quint64(1) << slot)) due += takeSlot(0, slot);
+    }
+    m_now = qMax(m_now, target);
+    for (const quint64 id : due) {
+        Entry& entry = m_timers[id];
+        entry.fireAt = m_now + 1;
+        insert(id, entry);
+    }
+}
+
+void TimerWheel::fire(const QVector<quint64>& ids) {
+    for (const quint64 id : ids) {
+        // 前面的回调可能已经取消了它。
+        const auto it = m_timers.find(id);
+        if (it == m_timers.end()) continue;
+        if (it->hasContext && !it->context) {
+            m_timers.erase(it);
+            continue;
+        }
+        const Callback fn = it->fn;
+        if (it->interval > 0) {
+            it->deadline += it->interval;
+            // 睡眠唤醒后错过的周期不补发。
+            if (it->deadline <= m_now) it->deadline = m_now + it->interval;
+            it->fireAt = alignedFireTime(it->deadline, it->slack);
+            insert(id, *it);
+        } else {
+            m_timers.erase(it);
+        }
+        fn();
+    }
+}
+
+void TimerWheel::dispatch() {
+    const qint64 now = m_clock.elapsed();
+    const qint64 second = now / 1000;
+    const int bucket = int(second % 60);
+    if (m_wakeupSecond[bucket] != second) {
+        m_wakeupSecond[bucket] = second;
+        m_wakeups[bucket] = 0;
+    }
+    ++m_wakeups[bucket];
+
+    m_armedAt = -1;
+    m_dispatching = true;
+    advance(now);
+    m_dispatching = false;
+    arm();
+}
+
+void TimerWheel::arm() {
+    const qint64 next = nextEventTime();
+    if (next < 0) {
+        m_driver.stop();
+        m_armedAt = -1;
+        return;
+    }
+    const qint64 wait = qBound<qint64>(0, next - m_clock.elapsed(), kMaxArmMs);
+    m_armedAt = next;
+    m_driver.start(int(wait));
+}
+
+int TimerWheel::wakeupsLastMinute() const {
+    const qint64 second = m_clock.elapsed() / 1000;
+    int total = 0;
+    for (int i = 0; i < 60; ++i) {
+        if (second - m_wakeupSecond[i] < 60) total += m_wakeups[i];
+    }
+    return total;
+}
+
+void TimerWheel::reportWakeups() {
+    Logger::instance().info(QString("定时调度：最近一分钟唤醒 %1 次，待触发定时器 %2 个")
+                                .arg(wakeupsLastMinute())
+                                .arg(m_timers.size()));
+}
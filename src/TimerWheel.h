@@ -0,0 +1,79 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <QVector>
+
+#include <functional>
+
+// 全局定时调度：各模块登记截止时间，由一个分层时间轮（7 层 × 64 槽，1ms 精度）统一管理，
+// 底层只保留一个单次 QTimer，总是只为最近一个有定时器的槽唤醒一次。
+// 登记时给出可容忍的推迟量 slack，截止时间会在 slack 内向上对齐到 2 的幂毫秒边界，
+// 相近的定时器因此落在同一次唤醒里。只在 UI 线程使用。
+class TimerWheel : public QObject {
+    Q_OBJECT
+public:
+    using Callback = std::function<void()>;
+
+    static TimerWheel& instance();
+
+    // 返回定时器编号（从 1 开始）；context 被销毁后定时器自动作废，可传 nullptr。
+    quint64 schedule(qint64 delayMs, QObject* context, Callback fn, qint64 slackMs = 0);
+    quint64 scheduleRepeating(qint64 intervalMs, QObject* context, Callback fn, qint64 slackMs = 0);
+    void cancel(quint64 id);
+    bool isScheduled(quint64 id) const { return m_timers.contains(id); }
+
+    // 到某个墙上时间的毫秒数，已经过去时为 0。
+    static qint64 msecsUntil(const QDateTime& when);
+
+    int pendingCount() const { return m_timers.size(); }
+    int wakeupsLastMinute() const;
+
+private:
+    static constexpr int kLevels = 7;
+    static constexpr int kSlotBits = 6;
+    static constexpr int kSlots = 1 << kSlotBits;
+
+    struct Entry {
+        qint64 deadline = 0;  // 请求的截止时间，重复定时器据此推算下一次，避免累积漂移
+        qint64 fireAt = 0;    // 对齐后的实际触发时间
+        qint64 interval = 0;  // 0 表示单次
+        qint64 slack = 0;
+        QPointer<QObject> context;
+        bool hasContext = false;
+        Callback fn;
+        int level = -1;
+        int slot = 0;
+        int pos = 0;
+    };
+
+    TimerWheel();
+    quint64 add(qint64 delayMs, qint64 intervalMs, QObject* context, Callback fn, qint64 slackMs);
+    qint64 alignedFireTime(qint64 deadline, qint64 slack) const;
+    void insert(quint64 id, Entry& entry);
+    void unlink(Entry& entry);
+    QVector<quint64> takeSlot(int level, int slot);
+    qint64 nextEventTime() const;
+    void cascade();
+    void advance(qint64 target);
+    void catchUp(qint64 target);
+    void fire(const QVector<quint64>& ids);
+    void dispatch();
+    void arm();
+    void reportWakeups();
+
+    QElapsedTimer m_clock;
+    QTimer m_driver;
+    qint64 m_now = 0;
+    qint64 m_armedAt = -1;
+    quint64 m_nextId = 1;
+    bool m_dispatching = false;
+    QHash<quint64, Entry> m_timers;
+    QVector<quint64> m_slots[kLevels][kSlots];
+    quint64 m_occupied[kLevels] = {};
+    int m_wakeups[60] = {};
+    qint64 m_wakeupSecond[60] = {};
+};
@@ -0,0 +1,256 @@
+#include "Timetable.h"
+
+#include "TimerWheel.h"
+#include "Utils.h"
+
+#include <QElapsedTimer>
+#include <QRegularExpression>
+
+#include <algorithm>
+
+namespace {
+constexpr qint64 kDayMs = 24 * 60 * 60 * 1000;
+constexpr int kMaxRangeDays = 366;
+constexpr int kSearchDays = 366;
+// 系统时间被调整或跨天时兜底重新计算。
+constexpr qint64 kRecheckMs = 10 * 60 * 1000;
+
+int weekdayOf(QChar c) {
+    static const QString kDays = QStringLiteral("一二三四五六日");
+    if (c == QChar(u'天')) return 7;
+    const int index = kDays.indexOf(c);
+    return index < 0 ? 0 : index + 1;
+}
+
+// “周一”“周一至周五”“周一、周三”，返回以 1..7 位表示的星期掩码，无法识别返回 0。
+int parseWeekdays(const QString& spec) {
+    static const QRegularExpression item(QStringLiteral("^(?:周|星期)(.)(?:[至~～](?:周|星期)(.))?$"));
+    int mask = 0;
+    for (const QString& part : spec.split(QRegularExpression(QStringLiteral("[、,，]")), Qt::SkipEmptyParts)) {
+        const QRegularExpressionMatch m = item.match(part);
+        if (!m.hasMatch()) return 0;
+        const int from = weekdayOf(m.captured(1).at(0));
+        const int to = m.captured(2).isEmpty() ? from : weekdayOf(m.captured(2).at(0));
+        if (from == 0 || to == 0) return 0;
+        for (int d = from;; d = d % 7 + 1) {
+            mask |= 1 << d;
+            if (d == to) break;
+        }
+    }
+    return mask;
+}
+
+QTime parseTime(const QString& text) {
+    return QTime::fromString(text.trimmed(), "H:mm");
+}
+
+QDateTime atOffset(const QDate& date, qint64 ms) {
+    return QDateTime(date, QTime::fromMSecsSinceStartOfDay(int(ms)));
+}
+}  // namespace
+
+struct Timetable::Rule {
+    int weekdays = 0xFE;  // 位 1..7 对应周一至周日
+    QDate from;           // 有效时按日期生效，否则按星期
+    QDate to;
+    bool holiday = false;
+    qint64 start = 0;
+    qint64 end = 0;
+};
+
+bool Timetable::parseRule(const QString& text, QString* error) {
+    Rule rule;
+    return parse(text, &rule, error);
+}
+
+bool Timetable::parse(const QString& text, Rule* rule, QString* error) {
+    static const QRegularExpression datePattern(
+        QStringLiteral("^(\\d{4}-\\d{1,2}-\\d{1,2})(?:[~～至](\\d{4}-\\d{1,2}-\\d{1,2}))?$"));
+    const auto fail = [error](const QString& message) {
+        if (error) *error = message;
+        return false;
+    };
+
+    QStringList tokens = text.trimmed().split(QRegularExpression(QStringLiteral("\\s+")), Qt::SkipEmptyParts);
+    if (tokens.isEmpty()) return fail("规则为空");
+    const QString body = tokens.takeLast();
+    const QString scope = tokens.join(QString());
+
+    if (!scope.isEmpty()) {
+        const QRegularExpressionMatch m = datePattern.match(scope);
+        if (m.hasMatch()) {
+            rule->from = QDate::fromString(m.captured(1), "yyyy-M-d");
+            rule->to = m.captured(2).isEmpty() ? rule->from : QDate::fromString(m.captured(2), "yyyy-M-d");
+            if (!rule->from.isValid() || !rule->to.isValid() || rule->to < rule->from) return fail("日期无效");
+            if (rule->from.daysTo(rule->to) >= kMaxRangeDays) return fail("日期范围不能超过一年");
+        } else {
+            rule->weekdays = parseWeekdays(scope);
+            if (rule->weekdays == 0) return fail("无法识别的星期或日期：" + scope);
+        }
+    }
+
+    if (body == "休" || body == "放假") {
+        if (!rule->from.isValid()) return fail("放假规则需要写明日期");
+        rule->holiday = true;
+        return true;
+    }
+    const QStringList parts = body.split('-', Qt::SkipEmptyParts);
+    const QTime s = parts.size() == 2 ? parseTime(parts[0]) : QTime();
+    const QTime e = parts.size() == 2 ? parseTime(parts[1]) : QTime();
+    if (!s.isValid() || !e.isValid()) return fail("时间段格式应为 HH:mm-HH:mm");
+    if (e <= s) return fail("结束时间需晚于开始时间");
+    rule->start = s.msecsSinceStartOfDay();
+    rule->end = e.msecsSinceStartOfDay();
+    return true;
+}
+
+void Timetable::compile(const QStringList& rules) {
+    m_rules.clear();
+    m_week.clear();
+    m_dates.clear();
+
+    for (const QString& text : rules) {
+        Rule rule;
+        if (!parse(text, &rule, nullptr)) continue;
+        const int index = m_rules.size();
+        m_rules.append(text.trimmed());
+        if (rule.from.isValid()) {
+            for (QDate d = rule.from; d <= rule.to; d = d.addDays(1)) {
+                QVector<Interval>& day = m_dates[d.toJulianDay()];
+                if (!rule.holiday) day.append({rule.start, rule.end, index});
+            }
+            continue;
+        }
+        for (int weekday = 1; weekday <= 7; ++weekday) {
+            if (!(rule.weekdays & (1 << weekday))) continue;
+            const qint64 base = (weekday - 1) * kDayMs;
+            m_week.append({base + rule.start, base + rule.end, index});
+        }
+    }
+
+    normalize(m_week);
+    for (auto it = m_dates.begin(); it != m_dates.end(); ++it) normalize(it.value());
+    for (int d = 0; d < 7; ++d) {
+        const auto first = std::lower_bound(m_week.cbegin(), m_week.cend(), d * kDayMs,
+                                            [](const Interval& iv, qint64 ms) { return iv.start < ms; });
+        m_dayBegin[d] = int(first - m_week.cbegin());
+    }
+    m_dayBegin[7] = m_week.size();
+}
+
+// 排序并合并重叠或首尾相接的区间，之后起点和终点都严格递增。
+void Timetable::normalize(QVector<Interval>& intervals) {
+    std::sort(intervals.begin(), intervals.end(), [](const Interval& a, const Interval& b) { return a.start < b.start; });
+    int out = 0;
+    for (int i = 0; i < intervals.size(); ++i) {
+        if (out > 0 && intervals[i].start <= intervals[out - 1].end) {
+            intervals[out - 1].end = qMax(intervals[out - 1].end, intervals[i].end);
+        } else {
+            intervals[out++] = intervals[i];
+        }
+    }
+    intervals.resize(out);
+}
+
+const Timetable::Interval* Timetable::dayIntervals(const QDate& date, int* count, qint64* base) const {
+    const auto it = m_dates.constFind(date.toJulianDay());
+    if (it != m_dates.constEnd()) {
+        *count = it->size();
+        *base = 0;
+        return it->constData();
+    }
+    const int weekday = date.dayOfWeek() - 1;
+    *count = m_dayBegin[weekday + 1] - m_dayBegin[weekday];
+    *base = weekday * kDayMs;
+    return m_week.constData() + m_dayBegin[weekday];
+}
+
+bool Timetable::periodAt(const QDateTime& when, Period* period) const {
+    int count = 0;
+    qint64 base = 0;
+    const QDate date = when.date();
+    const Interval* intervals = dayIntervals(date, &count, &base);
+    const qint64 ms = base + when.time().msecsSinceStartOfDay();
+    const Interval* it = std::upper_bound(intervals, intervals + count, ms,
+                                          [](qint64 value, const Interval& iv) { return value < iv.start; });
+    if (it == intervals || (it - 1)->end <= ms) return false;
+    --it;
+    if (period) {
+        period->start = atOffset(date, it->start - base);
+        period->end = atOffset(date, it->end - base);
+        period->rule = m_rules.value(it->rule);
+    }
+    return true;
+}
+
+QDateTime Timetable::nextTransition(const QDateTime& after) const {
+    QDate date = after.date();
+    qint64 msOfDay = after.time().msecsSinceStartOfDay();
+    for (int i = 0; i < kSearchDays; ++i, date = date.addDays(1), msOfDay = -1) {
+        int count = 0;
+        qint64 base = 0;
+        const Interval* intervals = dayIntervals(date, &count, &base);
+        const qint64 ms = base + msOfDay;
+        // 区间互不重叠，终点同样有序：第一个终点晚于 ms 的区间给出下一个边界。
+        const Interval* it = std::upper_bound(intervals, intervals + count, ms,
+                                              [](qint64 value, const Interval& iv) { return value < iv.end; });
+        if (it == intervals + count) continue;
+        return atOffset(date, (it->start > ms ? it->start : it->end) - base);
+    }
+    return QDateTime();
+}
+
+TimetableMonitor& TimetableMonitor::instance() {
+    static TimetableMonitor monitor;
+    return monitor;
+}
+
+TimetableMonitor::TimetableMonitor() {
+    connect(Config::instance().notifier(), &ConfigNotifier::changed, this, [this](ConfigChange::Flags changes) {
+        if (changes.testFlag(ConfigChange::SelfStudy)) reload();
+    });
+    reload();
+}
+
+bool TimetableMonitor::current(Timetable::Period* period) const {
+    return m_table.periodAt(QDateTime::currentDateTime(), period);
+}
+
+void TimetableMonitor::reload() {
+    QElapsedTimer timer;
+    timer.start();
+    const QStringList& rules = Config::instance().selfStudyPeriods;
+    m_table.compile(rules);
+    if (m_table.ruleCount() < rules.size()) {
+        Logger::instance().warn(QString("自习时段有 %1 条规则无法识别，已忽略").arg(rules.size() - m_table.ruleCount()));
+    }
+    Logger::instance().info(QString("自习时段表编译：%1 条规则，耗时 %2 ms")
+                                .arg(m_table.ruleCount())
+                                .arg(timer.nsecsElapsed() / 1e6, 0, 'f', 3));
+    evaluate();
+}
+
+void TimetableMonitor::evaluate() {
+    const QDateTime now = QDateTime::currentDateTime();
+    Timetable::Period period;
+    const bool inPeriod = m_table.periodAt(now, &period);
+    if (m_inPeriod && (!inPeriod || period.start != m_periodStart)) {
+        m_inPeriod = false;
+        emit periodEnded();
+    }
+    if (inPeriod && !m_inPeriod) {
+        m_inPeriod = true;
+        m_periodStart = period.start;
+        emit periodStarted(period);
+    }
+
+    qint64 wait = kRecheckMs;
+    const QDateTime next = m_table.nextTransition(now);
+    if (next.isValid()) wait = qMin(wait, TimerWheel::msecsUntil(next));
+    TimerWheel& wheel = TimerWheel::instance();
+    wheel.cancel(m_timer);
+    m_timer = wheel.schedule(wait, this, [this]() {
+        m_timer = 0;
+        evaluate();
+    }, 200);
+}
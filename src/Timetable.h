@@ -0,0 +1,73 @@
+#pragma once
+
+#include <QDateTime>
+#include <QHash>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// 自习时段表。每条规则是一行文本：
+//   19:00-19:45                    每天
+//   周一至周五 19:00-19:45          指定星期（也可写 周一、周三）
+//   2026-10-10 19:30-20:15         指定日期，当天只按这类规则安排（调课、补课）
+//   2026-10-01~2026-10-07 休        假期，当天没有自习
+// 编译一次后按星期存成有序、互不重叠的区间（前闭后开），查询和求下一个边界都是二分查找。
+class Timetable {
+public:
+    struct Period {
+        QDateTime start;
+        QDateTime end;
+        QString rule;
+    };
+
+    static bool parseRule(const QString& text, QString* error = nullptr);
+
+    void compile(const QStringList& rules);
+    bool periodAt(const QDateTime& when, Period* period = nullptr) const;
+    // 严格晚于 after 的下一个进入或离开时段的时刻；一年内没有则返回无效时间。
+    QDateTime nextTransition(const QDateTime& after) const;
+    int ruleCount() const { return m_rules.size(); }
+
+private:
+    struct Interval {
+        qint64 start;  // 毫秒，周表从周一 0 点起算，日期表从当天 0 点起算
+        qint64 end;
+        int rule;
+    };
+    struct Rule;
+
+    static bool parse(const QString& text, Rule* rule, QString* error);
+    static void normalize(QVector<Interval>& intervals);
+    const Interval* dayIntervals(const QDate& date, int* count, qint64* base) const;
+
+    QStringList m_rules;
+    QVector<Interval> m_week;
+    int m_dayBegin[8] = {};  // 周表中每天第一段的下标，m_dayBegin[7] 为总数
+    QHash<qint64, QVector<Interval>> m_dates;  // 儒略日 → 当天的区间，空表示放假
+};
+
+// 按配置中的自习时段维护当前状态：只在下一个边界唤醒一次（借助 TimerWheel），
+// 边界到达时发出进入、离开信号，供自动息屏、息屏页进度等订阅。只在 UI 线程使用。
+class TimetableMonitor : public QObject {
+    Q_OBJECT
+public:
+    static TimetableMonitor& instance();
+
+    const Timetable& timetable() const { return m_table; }
+    bool current(Timetable::Period* period = nullptr) const;
+
+signals:
+    void periodStarted(const Timetable::Period& period);
+    void periodEnded();
+
+private:
+    TimetableMonitor();
+    void reload();
+    void evaluate();
+
+    Timetable m_table;
+    bool m_inPeriod = false;
+    QDateTime m_periodStart;
+    quint64 m_timer = 0;
+};
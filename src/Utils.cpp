@@ -1,14 +1,27 @@
 #include "Utils.h"
 
+#include "ClassStore.h"
+#include "ConfigWatcher.h"
+#include "ConfigWriter.h"
+#include "RosterImport.h"
+
+#include <QCborArray>
+#include <QCborMap>
+#include <QCborValue>
 #include <QCoreApplication>
 #include <QDateTime>
 #include <QDir>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QFileInfo>
+#include <QHash>
 #include <QMutexLocker>
+#include <QTemporaryDir>
 #include <QTextStream>
 
 #include <atomic>
+#include <iterator>
+#include <limits>
 
 namespace {
 constexpr int kSidebarWidth = 84;
@@ -58,39 +71,282 @@ void normalizeSystemButtonIcons(QVector<AppButton>& buttons) {
     }
 }
 
-void applyDefaults(Config& config, QVector<AppButton>& buttons, QStringList& students) {
-    config.seewoPath = "C:/Program Files (x86)/Seewo/EasiNote5/swenlauncher/swenlauncher.exe";
-    config.iconSize = 46;
-    config.floatingBallSize = 72;
-    config.floatingOpacity = 85;
-    config.attendanceSummaryWidth = 420;
-    config.radialMenuRadius = 210;
-    config.menuAutoCollapseSeconds = 15;
-    config.startCollapsed = true;
-    config.trayClickToOpen = true;
-    config.showAttendanceSummaryOnStart = true;
-    config.randomNoRepeat = true;
-    config.allowExternalLinks = false;
-    config.compactMode = false;
-    config.randomHistorySize = 5;
-    config.animationDurationMs = 240;
-    config.sidebarWidth = 92;
-    config.groupSplitSize = 4;
-    config.scoreTeamAName = "红队";
-    config.scoreTeamBName = "蓝队";
-    config.collapseHidesToolWindows = true;
-    config.firstRunCompleted = false;
-    config.classNote = "";
-    config.floatingBallX = -1;
-    config.floatingBallY = -1;
-    config.selfStudyPeriods = QStringList() << QStringLiteral("19:00-19:45");
-    config.selfStudyIdleSeconds = 180;
-    config.screenOffShowQuote = true;
+bool isCoreTarget(const QString& target) {
+    return target == "SEEWO" || target == "ATTENDANCE" || target == "RANDOM_CALL"
+        || target == "AI_ASSISTANT" || target == "SETTINGS" || target == "SCREEN_OFF";
+}
+
+// 与历史 load() 的按钮处理一致：清洗字段、修正系统图标、仅保留内置目标、补齐设置/息屏。
+void normalizeButtonList(QVector<AppButton>& buttons) {
+    QVector<AppButton> cleaned;
+    cleaned.reserve(buttons.size());
+    for (AppButton b : buttons) {
+        b.name = b.name.trimmed();
+        b.action = b.action.trimmed();
+        b.target = b.target.trimmed();
+        if (b.name.isEmpty() || b.action.isEmpty() || b.target.isEmpty()) {
+            continue;
+        }
+        if (b.target == "classisland://open") {
+            continue;
+        }
+        b.iconPath = b.iconPath.trimmed();
+        if (b.iconPath.startsWith(":/assets/")) {
+            b.iconPath = b.iconPath.mid(QString(":/assets/").size());
+        }
+        cleaned.append(b);
+    }
+
+    normalizeSystemButtonIcons(cleaned);
+
+    buttons.clear();
+    for (const auto& b : cleaned) {
+        if (isCoreTarget(b.target)) {
+            buttons.append(b);
+        }
+    }
+
+    if (buttons.isEmpty()) {
+        buttons = buildDefaultButtons();
+    }
+    bool hasSettings = false;
+    bool hasScreenOff = false;
+    for (const auto& b : buttons) {
+        if (b.target == "SETTINGS") hasSettings = true;
+        if (b.target == "SCREEN_OFF") hasScreenOff = true;
+    }
+    if (!hasScreenOff) {
+        buttons.append({"息屏", "icon_screen_off.svg", "func", "SCREEN_OFF", true});
+    }
+    if (!hasSettings) {
+        buttons.append({"设置", "icon_settings.svg", "func", "SETTINGS", true});
+    }
+}
+
+// ---- 配置字段表 ----
+// 默认值、取值范围、引入版本与变更类别只在这里声明一次，
+// 加载、保存、恢复默认与校验都由该表生成。
+constexpr int kSchemaVersion = 2;  // 1 = 没有 schemaVersion 字段的历史文件
+constexpr int kNoMin = std::numeric_limits<int>::min();
+constexpr int kNoMax = std::numeric_limits<int>::max();
+
+enum class FieldType : quint8 { Int, Bool, String, List };
+
+enum FieldFlag : quint8 {
+    kNoFlag = 0,
+    kTrim = 1,
+    kNonEmpty = 2,
+    kKeepOnReset = 4,
+};
+
+constexpr quint32 fieldHash(const char* key) {
+    quint32 h = 2166136261u;
+    for (; *key; ++key) {
+        h ^= static_cast<quint8>(*key);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+quint32 fieldHash(const QString& key) {
+    quint32 h = 2166136261u;
+    for (const QChar c : key) {
+        h ^= c.unicode();
+        h *= 16777619u;
+    }
+    return h;
+}
+
+union FieldMember {
+    int Config::*asInt;
+    bool Config::*asBool;
+    QString Config::*asString;
+    QStringList Config::*asList;
+
+    constexpr FieldMember(int Config::*m) : asInt(m) {}
+    constexpr FieldMember(bool Config::*m) : asBool(m) {}
+    constexpr FieldMember(QString Config::*m) : asString(m) {}
+    constexpr FieldMember(QStringList Config::*m) : asList(m) {}
+};
+
+struct FieldSpec {
+    const char* key;
+    FieldType type;
+    FieldMember member;
+    int intDefault;
+    int minValue;
+    int maxValue;
+    const char* textDefault;
+    quint8 flags;
+    ConfigChange::Flag change;
+    int since;
+    quint32 hash;
+};
+
+constexpr FieldSpec intField(const char* key, int Config::*m, int def, int lo, int hi, ConfigChange::Flag change, int since = 1) {
+    return {key, FieldType::Int, m, def, lo, hi, "", kNoFlag, change, since, fieldHash(key)};
+}
+
+constexpr FieldSpec boolField(const char* key, bool Config::*m, bool def, ConfigChange::Flag change, int since = 1) {
+    return {key, FieldType::Bool, m, def ? 1 : 0, 0, 1, "", kNoFlag, change, since, fieldHash(key)};
+}
+
+constexpr FieldSpec stringField(const char* key, QString Config::*m, const char* def, quint8 flags, ConfigChange::Flag change, int since = 1) {
+    return {key, FieldType::String, m, 0, 0, 0, def, flags, change, since, fieldHash(key)};
+}
+
+constexpr FieldSpec listField(const char* key, QStringList Config::*m, const char* def, ConfigChange::Flag change, int since = 1) {
+    return {key, FieldType::List, m, 0, 0, 0, def, kNoFlag, change, since, fieldHash(key)};
+}
+
+constexpr FieldSpec kFields[] = {
+    stringField("seewoPath", &Config::seewoPath, "C:/Program Files (x86)/Seewo/EasiNote5/swenlauncher/swenlauncher.exe",
+                kTrim | kNonEmpty, ConfigChange::Behavior),
+    intField("iconSize", &Config::iconSize, 46, 28, 72, ConfigChange::IconSize),
+    intField("floatingBallSize", &Config::floatingBallSize, 72, 56, 96, ConfigChange::BallSize),
+    intField("floatingOpacity", &Config::floatingOpacity, 85, 35, 100, ConfigChange::BallOpacity),
+    intField("attendanceSummaryWidth", &Config::attendanceSummaryWidth, 420, 360, 660, ConfigChange::AttendanceSummary),
+    intField("radialMenuRadius", &Config::radialMenuRadius, 210, 150, 280, ConfigChange::RadialLayout),
+    intField("menuAutoCollapseSeconds", &Config::menuAutoCollapseSeconds, 15, 5, 60, ConfigChange::Behavior),
+    boolField("startCollapsed", &Config::startCollapsed, true, ConfigChange::Behavior),
+    boolField("trayClickToOpen", &Config::trayClickToOpen, true, ConfigChange::Behavior),
+    boolField("showAttendanceSummaryOnStart", &Config::showAttendanceSummaryOnStart, true, ConfigChange::AttendanceSummary),
+    boolField("randomNoRepeat", &Config::randomNoRepeat, true, ConfigChange::Behavior),
+    boolField("randomFairWeighted", &Config::randomFairWeighted, false, ConfigChange::Behavior),
+    boolField("allowExternalLinks", &Config::allowExternalLinks, false, ConfigChange::Behavior),
+    boolField("compactMode", &Config::compactMode, false, ConfigChange::Behavior),
+    intField("randomHistorySize", &Config::randomHistorySize, 5, 3, 10, ConfigChange::Behavior),
+    intField("animationDurationMs", &Config::animationDurationMs, 240, 120, 600, ConfigChange::Behavior),
+    intField("sidebarWidth", &Config::sidebarWidth, 92, 84, 128, ConfigChange::Behavior),
+    intField("groupSplitSize", &Config::groupSplitSize, 4, 2, 12, ConfigChange::Behavior),
+    listField("groupKeepApart", &Config::groupKeepApart, "", ConfigChange::Behavior),
+    listField("groupKeepTogether", &Config::groupKeepTogether, "", ConfigChange::Behavior),
+    stringField("scoreTeamAName", &Config::scoreTeamAName, "红队", kNoFlag, ConfigChange::Behavior),
+    stringField("scoreTeamBName", &Config::scoreTeamBName, "蓝队", kNoFlag, ConfigChange::Behavior),
+    boolField("collapseHidesToolWindows", &Config::collapseHidesToolWindows, true, ConfigChange::Behavior),
+    boolField("firstRunCompleted", &Config::firstRunCompleted, false, ConfigChange::Behavior),
+    stringField("classNote", &Config::classNote, "", kNoFlag, ConfigChange::Behavior),
+    stringField("siliconFlowApiKey", &Config::siliconFlowApiKey, "", kTrim | kKeepOnReset, ConfigChange::Behavior),
+    stringField("siliconFlowModel", &Config::siliconFlowModel, "Qwen/Qwen3-8B", kTrim | kNonEmpty | kKeepOnReset, ConfigChange::Behavior),
+    stringField("siliconFlowEndpoint", &Config::siliconFlowEndpoint, "https://api.siliconflow.cn/v1/chat/completions",
+                kTrim | kNonEmpty | kKeepOnReset, ConfigChange::Behavior),
+    intField("floatingBallX", &Config::floatingBallX, -1, kNoMin, kNoMax, ConfigChange::None),
+    intField("floatingBallY", &Config::floatingBallY, -1, kNoMin, kNoMax, ConfigChange::None),
+    listField("selfStudyPeriods", &Config::selfStudyPeriods, "19:00-19:45", ConfigChange::SelfStudy),
+    intField("selfStudyIdleSeconds", &Config::selfStudyIdleSeconds, 180, 60, 900, ConfigChange::SelfStudy),
+    boolField("screenOffShowQuote", &Config::screenOffShowQuote, true, ConfigChange::SelfStudy),
+};
+
+constexpr int kFieldCount = static_cast<int>(std::size(kFields));
+static_assert(kFieldCount <= 64, "FieldPass 使用 64 位掩码记录已出现字段");
+
+constexpr bool fieldHashesUnique() {
+    for (int i = 0; i < kFieldCount; ++i) {
+        for (int j = i + 1; j < kFieldCount; ++j) {
+            if (kFields[i].hash == kFields[j].hash) return false;
+        }
+    }
+    return true;
+}
+static_assert(fieldHashesUnique(), "配置字段键哈希冲突");
+
+const FieldSpec* findField(const QString& key) {
+    static const QHash<quint32, int> index = []() {
+        QHash<quint32, int> h;
+        h.reserve(kFieldCount);
+        for (int i = 0; i < kFieldCount; ++i) h.insert(kFields[i].hash, i);
+        return h;
+    }();
+    const auto it = index.constFind(fieldHash(key));
+    if (it == index.constEnd()) return nullptr;
+    const FieldSpec& spec = kFields[*it];
+    return key == QLatin1String(spec.key) ? &spec : nullptr;
+}
+
+template <typename T>
+bool assignField(Config& config, T Config::*member, const T& value) {
+    if (config.*member == value) return false;
+    config.*member = value;
+    return true;
+}
+
+// 缺失或类型不符的值回落到默认值；返回字段是否发生变化。
+bool applyFieldValue(Config& config, const FieldSpec& spec, const QJsonValue& value) {
+    switch (spec.type) {
+    case FieldType::Int:
+        return assignField(config, spec.member.asInt, qBound(spec.minValue, value.toInt(spec.intDefault), spec.maxValue));
+    case FieldType::Bool:
+        return assignField(config, spec.member.asBool, value.toBool(spec.intDefault != 0));
+    case FieldType::String: {
+        const QString fallback = QString::fromUtf8(spec.textDefault);
+        QString text = value.toString(fallback);
+        if (spec.flags & kTrim) text = text.trimmed();
+        if ((spec.flags & kNonEmpty) && text.isEmpty()) text = fallback;
+        return assignField(config, spec.member.asString, text);
+    }
+    case FieldType::List: {
+        QStringList items;
+        for (const auto& v : value.toArray()) {
+            const QString item = v.toString().trimmed();
+            if (!item.isEmpty()) items.append(item);
+        }
+        if (items.isEmpty() && spec.textDefault[0] != '\0') items.append(QString::fromUtf8(spec.textDefault));
+        return assignField(config, spec.member.asList, items);
+    }
+    }
+    return false;
+}
+
+void writeFieldValue(const Config& config, const FieldSpec& spec, QJsonObject& root) {
+    const QString key = QString::fromLatin1(spec.key);
+    switch (spec.type) {
+    case FieldType::Int: root.insert(key, config.*spec.member.asInt); break;
+    case FieldType::Bool: root.insert(key, config.*spec.member.asBool); break;
+    case FieldType::String: root.insert(key, config.*spec.member.asString); break;
+    case FieldType::List: root.insert(key, QJsonArray::fromStringList(config.*spec.member.asList)); break;
+    }
+}
+
+void resetFields(Config& config, bool keepPreserved) {
+    for (const FieldSpec& spec : kFields) {
+        if (keepPreserved && (spec.flags & kKeepOnReset)) continue;
+        applyFieldValue(config, spec, QJsonValue(QJsonValue::Undefined));
+    }
+}
+
+void applyDefaults(Config& config, QVector<AppButton>& buttons, RosterPtr& roster) {
+    resetFields(config, true);
     buttons = buildDefaultButtons();
     normalizeSystemButtonIcons(buttons);
-    students = defaultStudents();
+    roster = Roster::fromNames(defaultStudents());
 }
 
+// 对文档做一次线性遍历：按键哈希定位字段，遍历结束后把未出现的字段回落到默认值。
+class FieldPass {
+public:
+    FieldPass(Config& config, int version) : m_config(config), m_version(version) {}
+
+    void apply(const FieldSpec& spec, const QJsonValue& value) {
+        if (spec.since > m_version) return;
+        m_seen |= quint64(1) << (&spec - kFields);
+        if (applyFieldValue(m_config, spec, value)) m_changes |= spec.change;
+    }
+
+    ConfigChange::Flags finish() {
+        for (int i = 0; i < kFieldCount; ++i) {
+            if (m_seen & (quint64(1) << i)) continue;
+            if (applyFieldValue(m_config, kFields[i], QJsonValue(QJsonValue::Undefined))) m_changes |= kFields[i].change;
+        }
+        return m_changes;
+    }
+
+private:
+    Config& m_config;
+    int m_version;
+    quint64 m_seen = 0;
+    ConfigChange::Flags m_changes;
+};
+
 }  // namespace
 
 Config& Config::instance() {
@@ -106,176 +362,221 @@ Config::Config() {
     const QString dataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
     QDir().mkpath(dataPath);
     m_configPath = dataPath + "/config.json";
+    m_writer = std::make_unique<ConfigWriter>(m_configPath);
+    m_notifier = std::make_unique<ConfigNotifier>();
+    m_classes = std::make_unique<ClassStore>(dataPath + "/classes");
+    resetFields(*this, false);
     load();
+    m_watcher = std::make_unique<ConfigWatcher>(m_configPath, m_writer.get());
+    QObject::connect(m_watcher.get(), &ConfigWatcher::changedOnDisk, m_notifier.get(),
+                     [this](const QJsonObject& root) { applyExternal(root); });
 }
 
+Config::~Config() = default;
+
 void Config::load() {
-    QFile file(m_configPath);
-    if (!file.open(QIODevice::ReadOnly)) {
-        applyDefaults(*this, m_buttons, m_students);
-        save();
+    m_writer->flush();
+    QElapsedTimer timer;
+    timer.start();
+    if (loadSnapshot()) {
+        Logger::instance().info(QString("配置加载（二进制快照）耗时 %1 ms").arg(timer.nsecsElapsed() / 1e6, 0, 'f', 2));
         return;
     }
 
-    const auto doc = QJsonDocument::fromJson(file.readAll());
+    QFile file(m_configPath);
+    const auto doc = file.open(QIODevice::ReadOnly) ? QJsonDocument::fromJson(file.readAll()) : QJsonDocument();
     if (!doc.isObject()) {
-        applyDefaults(*this, m_buttons, m_students);
+        QVector<AppButton> buttons;
+        applyDefaults(*this, buttons, m_configRoster);
+        publish(buttons, activeRoster());
         save();
         return;
     }
 
-    const QJsonObject root = doc.object();
-    seewoPath = root["seewoPath"].toString().trimmed();
-    iconSize = qBound(28, root["iconSize"].toInt(46), 72);
-    floatingBallSize = qBound(56, root["floatingBallSize"].toInt(72), 96);
-    floatingOpacity = qBound(35, root["floatingOpacity"].toInt(85), 100);
-    attendanceSummaryWidth = qBound(360, root["attendanceSummaryWidth"].toInt(420), 660);
-    radialMenuRadius = qBound(150, root["radialMenuRadius"].toInt(210), 280);
-    menuAutoCollapseSeconds = qBound(5, root["menuAutoCollapseSeconds"].toInt(15), 60);
-    startCollapsed = root["startCollapsed"].toBool(true);
-    trayClickToOpen = root["trayClickToOpen"].toBool(true);
-    showAttendanceSummaryOnStart = root["showAttendanceSummaryOnStart"].toBool(true);
-    randomNoRepeat = root["randomNoRepeat"].toBool(true);
-    allowExternalLinks = root["allowExternalLinks"].toBool(false);
-    compactMode = root["compactMode"].toBool(false);
-    randomHistorySize = qBound(3, root["randomHistorySize"].toInt(5), 10);
-    animationDurationMs = qBound(120, root["animationDurationMs"].toInt(240), 600);
-    sidebarWidth = qBound(84, root["sidebarWidth"].toInt(92), 128);
-    groupSplitSize = qBound(2, root["groupSplitSize"].toInt(4), 12);
-    scoreTeamAName = root["scoreTeamAName"].toString("红队");
-    scoreTeamBName = root["scoreTeamBName"].toString("蓝队");
-    collapseHidesToolWindows = root["collapseHidesToolWindows"].toBool(true);
-    firstRunCompleted = root["firstRunCompleted"].toBool(false);
-    classNote = root["classNote"].toString();
-    siliconFlowApiKey = root["siliconFlowApiKey"].toString().trimmed();
-    siliconFlowModel = root["siliconFlowModel"].toString("Qwen/Qwen3-8B").trimmed();
-    siliconFlowEndpoint = root["siliconFlowEndpoint"].toString("https://api.siliconflow.cn/v1/chat/completions").trimmed();
-    floatingBallX = root["floatingBallX"].toInt(-1);
-    floatingBallY = root["floatingBallY"].toInt(-1);
-    selfStudyPeriods.clear();
-    for (const auto& v : root["selfStudyPeriods"].toArray()) {
-        const QString p = v.toString().trimmed();
-        if (!p.isEmpty()) selfStudyPeriods.append(p);
-    }
-    selfStudyIdleSeconds = qBound(60, root["selfStudyIdleSeconds"].toInt(180), 900);
-    screenOffShowQuote = root["screenOffShowQuote"].toBool(true);
-
-    m_students.clear();
-    for (const auto& v : root["students"].toArray()) {
-        const QString name = v.toString().trimmed();
-        if (!name.isEmpty()) {
-            m_students.append(name);
-        }
+    applyJsonRoot(doc.object());
+    m_writer->scheduleSnapshot(toJson());
+    Logger::instance().info(QString("配置加载（JSON）耗时 %1 ms").arg(timer.nsecsElapsed() / 1e6, 0, 'f', 2));
+}
+
+ConfigChange::Flags Config::applyJsonRoot(const QJsonObject& root) {
+    const int version = root.value(QLatin1String("schemaVersion")).toInt(1);
+    FieldPass pass(*this, version);
+    for (auto it = root.constBegin(); it != root.constEnd(); ++it) {
+        if (const FieldSpec* spec = findField(it.key())) pass.apply(*spec, it.value());
     }
+    ConfigChange::Flags changes = pass.finish();
+
+    const RosterPtr roster = Roster::fromJson(root.value(QLatin1String("students")).toArray());
 
-    m_buttons.clear();
-    for (const auto& v : root["buttons"].toArray()) {
+    QVector<AppButton> buttons;
+    for (const auto& v : root.value(QLatin1String("buttons")).toArray()) {
         const auto o = v.toObject();
-        const QString name = o["name"].toString().trimmed();
-        const QString action = o["action"].toString().trimmed();
-        const QString target = o["target"].toString().trimmed();
-        if (name.isEmpty() || action.isEmpty() || target.isEmpty()) {
-            continue;
-        }
-        if (target == "classisland://open") {
-            continue;
-        }
-        QString iconRef = o["icon"].toString().trimmed();
-        if (iconRef.startsWith(":/assets/")) {
-            iconRef = iconRef.mid(QString(":/assets/").size());
-        }
-        m_buttons.append({name,
-                          iconRef,
-                          action,
-                          target,
-                          o["isSystem"].toBool(false)});
+        buttons.append({o["name"].toString(),
+                        o["icon"].toString(),
+                        o["action"].toString(),
+                        o["target"].toString(),
+                        o["isSystem"].toBool(false)});
+    }
+    return changes | applyLists(roster, buttons, false);
+}
+
+// 外部推送的配置只应用有差异的部分，不写回 config.json，仅刷新二进制快照。
+void Config::applyExternal(const QJsonObject& root) {
+    const ConfigChange::Flags changes = applyJsonRoot(root);
+    if (!changes) {
+        return;
     }
+    m_writer->scheduleSnapshot(toJson());
+    Logger::instance().info(QString("检测到外部配置修改，已应用变更 0x%1").arg(static_cast<quint32>(changes), 0, 16));
+    emit m_notifier->changed(changes);
+}
 
-    normalizeSystemButtonIcons(m_buttons);
+bool Config::loadSnapshot() {
+    const QFileInfo jsonInfo(m_configPath);
+    if (!jsonInfo.exists()) {
+        return false;
+    }
 
-    QVector<AppButton> filteredButtons;
-    for (const auto& b : m_buttons) {
-        if (b.target == "SEEWO" || b.target == "ATTENDANCE" || b.target == "RANDOM_CALL"
-            || b.target == "AI_ASSISTANT" || b.target == "SETTINGS" || b.target == "SCREEN_OFF") {
-            filteredButtons.append(b);
-        }
+    QByteArray payload;
+    if (!ConfigWriter::readSnapshot(m_writer->snapshotPath(), jsonInfo, &payload)) {
+        return false;
     }
-    m_buttons = filteredButtons;
 
-    if (seewoPath.isEmpty()) {
-        seewoPath = "C:/Program Files (x86)/Seewo/EasiNote5/swenlauncher/swenlauncher.exe";
+    const QCborMap root = QCborValue::fromCbor(payload).toMap();
+    if (root.value(QLatin1String("schemaVersion")).toInteger(1) != kSchemaVersion) {
+        return false;
     }
-    if (m_students.isEmpty()) {
-        m_students = defaultStudents();
+
+    const RosterPtr roster = Roster::fromJson(root.value(QLatin1String("students")).toArray().toJsonArray());
+
+    QVector<AppButton> buttons;
+    for (const auto& v : root.value(QLatin1String("buttons")).toArray()) {
+        const QCborMap o = v.toMap();
+        buttons.append({o.value(QLatin1String("name")).toString(),
+                        o.value(QLatin1String("icon")).toString(),
+                        o.value(QLatin1String("action")).toString(),
+                        o.value(QLatin1String("target")).toString(),
+                        o.value(QLatin1String("isSystem")).toBool(false)});
     }
-    if (m_buttons.isEmpty()) {
-        m_buttons = buildDefaultButtons();
+
+    if (roster->isEmpty() || buttons.isEmpty()) {
+        return false;
     }
-    bool hasSettings = false;
-    bool hasScreenOff = false;
-    for (const auto& b : m_buttons) {
-        if (b.target == "SETTINGS") hasSettings = true;
-        if (b.target == "SCREEN_OFF") hasScreenOff = true;
+
+    FieldPass pass(*this, kSchemaVersion);
+    for (auto it = root.constBegin(); it != root.constEnd(); ++it) {
+        if (const FieldSpec* spec = findField(it.key().toString())) pass.apply(*spec, it.value().toJsonValue());
     }
-    if (!hasScreenOff) {
-        m_buttons.append({"息屏", "icon_screen_off.svg", "func", "SCREEN_OFF", true});
+    pass.finish();
+    applyLists(roster, buttons, true);
+    return true;
+}
+
+void Config::benchmark(int students, int rounds) {
+    QTemporaryDir dir;
+    if (!dir.isValid()) return;
+    QJsonObject root = instance().toJson();
+    QJsonArray list;
+    for (int i = 0; i < students; ++i) {
+        list.append(QJsonObject{{"name", QString("学生%1").arg(i + 1)},
+                                {"number", QString::number(20260000 + i)},
+                                {"gender", i & 1 ? "女" : "男"},
+                                {"group", QString("第%1组").arg(i % 8 + 1)}});
     }
-    if (!hasSettings) {
-        m_buttons.append({"设置", "icon_settings.svg", "func", "SETTINGS", true});
+    root["students"] = list;
+
+    const QString path = dir.filePath("config.json");
+    QElapsedTimer timer;
+    timer.start();
+    {
+        ConfigWriter writer(path);
+        writer.schedule(root);
+        writer.shutdown();
     }
-    if (selfStudyPeriods.isEmpty()) { selfStudyPeriods = QStringList() << QStringLiteral("19:00-19:45"); }
-    if (siliconFlowModel.isEmpty()) {
-        siliconFlowModel = "Qwen/Qwen3-8B";
+    const double writeMs = timer.nsecsElapsed() / 1e6;
+
+    // 两条路径都做到解码出名单为止，与 load()/loadSnapshot() 的前半段一致。
+    qint64 checksum = 0;
+    timer.restart();
+    for (int i = 0; i < rounds; ++i) {
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly)) return;
+        const QJsonObject parsed = QJsonDocument::fromJson(file.readAll()).object();
+        checksum += Roster::fromJson(parsed.value(QLatin1String("students")).toArray())->size();
     }
-    if (siliconFlowEndpoint.isEmpty()) {
-        siliconFlowEndpoint = "https://api.siliconflow.cn/v1/chat/completions";
+    const double jsonMs = timer.nsecsElapsed() / 1e6 / rounds;
+
+    const QFileInfo jsonInfo(path);
+    const QString snapshotPath = dir.filePath("config.cbor");
+    timer.restart();
+    for (int i = 0; i < rounds; ++i) {
+        QByteArray payload;
+        if (!ConfigWriter::readSnapshot(snapshotPath, jsonInfo, &payload)) {
+            Logger::instance().warn("配置基准：快照校验失败");
+            return;
+        }
+        const QCborMap parsed = QCborValue::fromCbor(payload).toMap();
+        checksum += Roster::fromJson(parsed.value(QLatin1String("students")).toArray().toJsonArray())->size();
     }
+    const double snapshotMs = timer.nsecsElapsed() / 1e6 / rounds;
+
+    Logger::instance().info(QString("配置加载基准：名单 %1 人，写入 JSON+快照 %2 ms，"
+                                    "JSON 加载 %3 ms/次，快照加载 %4 ms/次，文件 %5 KB / %6 KB（校验 %7）")
+                                .arg(students)
+                                .arg(writeMs, 0, 'f', 2)
+                                .arg(jsonMs, 0, 'f', 3)
+                                .arg(snapshotMs, 0, 'f', 3)
+                                .arg(jsonInfo.size() / 1024)
+                                .arg(QFileInfo(snapshotPath).size() / 1024)
+                                .arg(checksum));
 }
 
-void Config::save() {
+// 只有校验过的二进制快照由本程序写出、按钮已经规范化，可以直接发布；
+// config.json 可能被手工或外部工具改过，按钮无论版本都要重新清洗。
+ConfigChange::Flags Config::applyLists(RosterPtr roster, QVector<AppButton> buttons, bool buttonsNormalized) {
+    if (!buttonsNormalized) {
+        normalizeButtonList(buttons);
+    }
+    if (roster->isEmpty()) {
+        roster = Roster::fromNames(defaultStudents());
+    }
+    if (buttons.isEmpty()) {
+        normalizeButtonList(buttons);
+    }
+
+    if (!m_configRoster || *roster != *m_configRoster) {
+        m_configRoster = roster;
+    }
+
+    // 当前选中的是其他班级时，config.json 的名单变化不影响正在使用的名单。
+    RosterPtr active = activeRoster();
+    const ConfigSnapshotPtr current = snapshot();
+    ConfigChange::Flags changes;
+    if (*active != *current->roster) {
+        changes |= ConfigChange::Roster;
+    } else {
+        active = current->roster;
+    }
+    if (buttons != current->buttons) changes |= ConfigChange::Buttons;
+    if (changes) {
+        publish(buttons, active);
+    }
+    return changes;
+}
+
+QJsonObject Config::toJson() const {
     QJsonObject root;
-    root["seewoPath"] = seewoPath;
-    root["iconSize"] = iconSize;
-    root["floatingBallSize"] = floatingBallSize;
-    root["floatingOpacity"] = floatingOpacity;
-    root["attendanceSummaryWidth"] = attendanceSummaryWidth;
-    root["radialMenuRadius"] = radialMenuRadius;
-    root["menuAutoCollapseSeconds"] = menuAutoCollapseSeconds;
-    root["startCollapsed"] = startCollapsed;
-    root["trayClickToOpen"] = trayClickToOpen;
-    root["showAttendanceSummaryOnStart"] = showAttendanceSummaryOnStart;
-    root["randomNoRepeat"] = randomNoRepeat;
-    root["allowExternalLinks"] = allowExternalLinks;
-    root["compactMode"] = compactMode;
-    root["randomHistorySize"] = randomHistorySize;
-    root["animationDurationMs"] = animationDurationMs;
-    root["sidebarWidth"] = sidebarWidth;
-    root["groupSplitSize"] = groupSplitSize;
-    root["scoreTeamAName"] = scoreTeamAName;
-    root["scoreTeamBName"] = scoreTeamBName;
-    root["collapseHidesToolWindows"] = collapseHidesToolWindows;
-    root["firstRunCompleted"] = firstRunCompleted;
-    root["classNote"] = classNote;
-    root["siliconFlowApiKey"] = siliconFlowApiKey;
-    root["siliconFlowModel"] = siliconFlowModel;
-    root["siliconFlowEndpoint"] = siliconFlowEndpoint;
-    root["floatingBallX"] = floatingBallX;
-    root["floatingBallY"] = floatingBallY;
-    QJsonArray selfStudyArr;
-    for (const auto& p : selfStudyPeriods) selfStudyArr.append(p);
-    root["selfStudyPeriods"] = selfStudyArr;
-    root["selfStudyIdleSeconds"] = selfStudyIdleSeconds;
-    root["screenOffShowQuote"] = screenOffShowQuote;
+    root["schemaVersion"] = kSchemaVersion;
+    for (const FieldSpec& spec : kFields) {
+        writeFieldValue(*this, spec, root);
+    }
     root["fixedSidebarWidth"] = kSidebarWidth;
 
-    QJsonArray stuArr;
-    for (auto it = m_students.cbegin(); it != m_students.cend(); ++it) {
-        stuArr.append(*it);
-    }
-    root["students"] = stuArr;
+    const ConfigSnapshotPtr snap = snapshot();
+    root["students"] = m_configRoster ? m_configRoster->toJson() : snap->roster->toJson();
 
     QJsonArray btnArr;
-    for (auto it = m_buttons.cbegin(); it != m_buttons.cend(); ++it) {
+    for (auto it = snap->buttons.cbegin(); it != snap->buttons.cend(); ++it) {
         const AppButton& b = *it;
         QJsonObject o;
         o["name"] = b.name;
@@ -286,79 +587,154 @@ void Config::save() {
         btnArr.append(o);
     }
     root["buttons"] = btnArr;
+    return root;
+}
 
-    QFile file(m_configPath);
-    if (file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-        file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+void Config::save() {
+    m_writer->schedule(toJson());
+}
+
+void Config::flush() {
+    m_writer->flush();
+}
+
+void Config::commit(ConfigChange::Flags changes) {
+    if (!changes) {
+        return;
+    }
+    // 其他班级的名单由 ClassStore 单独保存，只改了名单时不必重写 config.json。
+    if (changes != ConfigChange::Flags(ConfigChange::Roster) || m_classes->activeId().isEmpty()) {
+        save();
     }
+    emit m_notifier->changed(changes);
+}
+
+ConfigNotifier* Config::notifier() const {
+    return m_notifier.get();
 }
 
 void Config::resetToDefaults(bool preserveFirstRun) {
     const bool oldFirstRun = firstRunCompleted;
-    applyDefaults(*this, m_buttons, m_students);
+    QVector<AppButton> buttons;
+    applyDefaults(*this, buttons, m_configRoster);
+    publish(buttons, activeRoster());
     if (preserveFirstRun) {
         firstRunCompleted = oldFirstRun;
     }
-    save();
+    commit(ConfigChange::All);
 }
-QVector<AppButton> Config::getButtons() const { return m_buttons; }
 
-void Config::setButtons(const QVector<AppButton>& btns) {
-    m_buttons = btns;
-    save();
+ConfigSnapshotPtr Config::snapshot() const {
+    return std::atomic_load_explicit(&m_snapshot, std::memory_order_acquire);
 }
 
-QStringList Config::getStudentList() const { return m_students; }
+quint64 Config::generation() const {
+    return snapshot()->generation;
+}
 
-void Config::setStudentList(const QStringList& list) {
-    m_students = list;
-    save();
+void Config::publish(const QVector<AppButton>& buttons, const RosterPtr& roster) {
+    auto next = std::make_shared<ConfigSnapshot>();
+    next->generation = ++m_generation;
+    next->buttons = buttons;
+    next->roster = roster;
+    std::atomic_store_explicit(&m_snapshot, ConfigSnapshotPtr(std::move(next)), std::memory_order_release);
 }
 
-bool Config::importStudentsFromText(const QString& filePath, QString* errorMessage) {
-    const QString suffix = QFileInfo(filePath).suffix().toLower();
-    if (suffix == "xls" || suffix == "xlsx") {
-        if (errorMessage) {
-            *errorMessage = "当前版本不依赖第三方库，Excel 请先另存为 CSV 或 TXT 再导入。";
-        }
+QVector<AppButton> Config::getButtons() const { return snapshot()->buttons; }
+
+bool Config::setButtons(const QVector<AppButton>& btns) {
+    QVector<AppButton> buttons = btns;
+    normalizeButtonList(buttons);
+    const ConfigSnapshotPtr current = snapshot();
+    if (buttons == current->buttons) {
         return false;
     }
+    publish(buttons, current->roster);
+    return true;
+}
 
-    QFile file(filePath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        if (errorMessage) {
-            *errorMessage = "名单文件读取失败。";
-        }
+QStringList Config::getStudentList() const { return snapshot()->roster->names(); }
+
+bool Config::setStudentList(const QStringList& list) {
+    return setRoster(snapshot()->roster->withNames(list));
+}
+
+bool Config::setRoster(const RosterPtr& roster) {
+    const ConfigSnapshotPtr current = snapshot();
+    if (!roster || *roster == *current->roster) {
+        return false;
+    }
+    const QString classId = m_classes->activeId();
+    if (classId.isEmpty()) {
+        m_configRoster = roster;
+    } else if (!m_classes->store(classId, roster)) {
         return false;
     }
+    publish(current->buttons, roster);
+    return true;
+}
 
-    QStringList parsedStudents;
-    QTextStream in(&file);
-    while (!in.atEnd()) {
-        QString line = in.readLine().trimmed();
-        if (line.isEmpty()) {
-            continue;
-        }
-        line.replace(';', ',');
-        const QStringList parts = line.split(',', Qt::SkipEmptyParts);
-        for (const auto& part : parts) {
-            const QString name = part.trimmed();
-            if (!name.isEmpty()) {
-                parsedStudents.append(name);
-            }
+RosterPtr Config::activeRoster() {
+    const QString classId = m_classes->activeId();
+    if (!classId.isEmpty()) {
+        if (const RosterPtr roster = m_classes->load(classId)) {
+            return roster;
         }
+        m_classes->setActiveId(QString());
     }
+    return m_configRoster;
+}
 
-    parsedStudents.removeDuplicates();
-    if (parsedStudents.isEmpty()) {
-        if (errorMessage) {
-            *errorMessage = "文件中没有可用学生数据。";
-        }
+const ClassStore& Config::classes() const {
+    return *m_classes;
+}
+
+QString Config::activeClassName() const {
+    const QString classId = m_classes->activeId();
+    return classId.isEmpty() ? QStringLiteral("默认班级") : m_classes->nameOf(classId);
+}
+
+bool Config::switchClass(const QString& id) {
+    QElapsedTimer timer;
+    timer.start();
+    const RosterPtr roster = id.isEmpty() ? m_configRoster : m_classes->load(id);
+    if (!roster) {
+        return false;
+    }
+    m_classes->setActiveId(id);
+    const ConfigSnapshotPtr current = snapshot();
+    if (roster != current->roster) {
+        publish(current->buttons, roster);
+        emit m_notifier->changed(ConfigChange::Roster);
+    }
+    Logger::instance().info(QString("切换班级：%1（%2 人），耗时 %3 ms")
+                                .arg(activeClassName())
+                                .arg(roster->size())
+                                .arg(timer.nsecsElapsed() / 1e6, 0, 'f', 2));
+    return true;
+}
+
+QString Config::createClass(const QString& name, const QStringList& names) {
+    const RosterPtr roster = Roster::fromNames(names);
+    if (roster->isEmpty()) {
+        return QString();
+    }
+    const QString id = m_classes->create(name.trimmed().isEmpty() ? QStringLiteral("新班级") : name.trimmed(), roster);
+    if (!id.isEmpty()) {
+        switchClass(id);
+    }
+    return id;
+}
+
+bool Config::importStudentsFromText(const QString& filePath, QString* errorMessage) {
+    QStringList parsedStudents;
+    if (!RosterImporter::read(filePath, &parsedStudents, errorMessage)) {
         return false;
     }
 
-    m_students = parsedStudents;
-    save();
+    if (setStudentList(parsedStudents)) {
+        commit(ConfigChange::Roster);
+    }
     return true;
 }
 
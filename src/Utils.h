@@ -4,74 +4,160 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QMutex>
+#include <QObject>
 #include <QStandardPaths>
 #include <QString>
 #include <QStringList>
 #include <QVector>
 
+#include "Roster.h"
+
+#include <atomic>
+#include <memory>
+
+class ClassStore;
+class ConfigWatcher;
+class ConfigWriter;
+
 struct AppButton {
     QString name;
     QString iconPath;
     QString action;
     QString target;
     bool isSystem;
+
+    bool operator==(const AppButton& other) const {
+        return name == other.name && iconPath == other.iconPath && action == other.action
+            && target == other.target && isSystem == other.isSystem;
+    }
+    bool operator!=(const AppButton& other) const { return !(*this == other); }
+};
+
+// 配置变更类别：各组件只响应与自己相关的字段，避免整体重载。
+namespace ConfigChange {
+enum Flag : quint32 {
+    None = 0,
+    BallOpacity = 1u << 0,
+    BallSize = 1u << 1,
+    IconSize = 1u << 2,
+    RadialLayout = 1u << 3,
+    Buttons = 1u << 4,
+    Roster = 1u << 5,
+    AttendanceSummary = 1u << 6,
+    SelfStudy = 1u << 7,
+    Behavior = 1u << 8,
+    All = 0xffffffffu
+};
+Q_DECLARE_FLAGS(Flags, Flag)
+}
+Q_DECLARE_OPERATORS_FOR_FLAGS(ConfigChange::Flags)
+
+class ConfigNotifier : public QObject {
+    Q_OBJECT
+public:
+    using QObject::QObject;
+
+signals:
+    void changed(ConfigChange::Flags changes);
+};
+
+// 名单与按钮的不可变快照：写入方构建新快照后原子替换，任意线程读取无需加锁或拷贝。
+struct ConfigSnapshot {
+    quint64 generation = 0;
+    QVector<AppButton> buttons;
+    RosterPtr roster = std::make_shared<const Roster>();
 };
+using ConfigSnapshotPtr = std::shared_ptr<const ConfigSnapshot>;
 
 class Config {
 public:
     static Config& instance();
     static QVector<AppButton> defaultButtons();
+    // 冷启动基准：以当前配置加 students 人的名单，比较 JSON 与二进制快照两条加载路径。
+    static void benchmark(int students, int rounds);
 
     void load();
     void save();
+    void flush();
+    void commit(ConfigChange::Flags changes);
+    ConfigNotifier* notifier() const;
     void resetToDefaults(bool preserveFirstRun = false);
 
+    ConfigSnapshotPtr snapshot() const;
+    quint64 generation() const;
+
+    // set* 只发布新快照并返回是否有变化，保存与广播由 commit() 统一完成。
     QVector<AppButton> getButtons() const;
-    void setButtons(const QVector<AppButton>& btns);
+    bool setButtons(const QVector<AppButton>& btns);
 
     QStringList getStudentList() const;
-    void setStudentList(const QStringList& list);
+    bool setStudentList(const QStringList& list);
+    bool setRoster(const RosterPtr& roster);
+
+    // 多班级：空 ID 表示 config.json 中的默认班级名单。切换只发布新快照，不改写 config.json。
+    const ClassStore& classes() const;
+    QString activeClassName() const;
+    bool switchClass(const QString& id);
+    QString createClass(const QString& name, const QStringList& names);
     bool importStudentsFromText(const QString& filePath, QString* errorMessage = nullptr);
 
     QString resolveIconPath(const QString& iconRef) const;
 
-    int iconSize = 46;
-    int floatingBallSize = 72;
-    int floatingOpacity = 85;
-    int attendanceSummaryWidth = 360;
-    int radialMenuRadius = 210;
-    int menuAutoCollapseSeconds = 15;
-    bool startCollapsed = true;
-    bool trayClickToOpen = true;
-    bool showAttendanceSummaryOnStart = true;
-    bool randomNoRepeat = true;
-    bool allowExternalLinks = false;
-    bool compactMode = false;
-    int randomHistorySize = 5;
-    int animationDurationMs = 240;
-    int sidebarWidth = 92;
-    int groupSplitSize = 4;
-    QString scoreTeamAName = "红队";
-    QString scoreTeamBName = "蓝队";
-    bool collapseHidesToolWindows = true;
-    bool firstRunCompleted = false;
+    // 默认值、取值范围与引入版本统一见 Utils.cpp 中的字段表 kFields。
+    int iconSize;
+    int floatingBallSize;
+    int floatingOpacity;
+    int attendanceSummaryWidth;
+    int radialMenuRadius;
+    int menuAutoCollapseSeconds;
+    bool startCollapsed;
+    bool trayClickToOpen;
+    bool showAttendanceSummaryOnStart;
+    bool randomNoRepeat;
+    bool randomFairWeighted;
+    bool allowExternalLinks;
+    bool compactMode;
+    int randomHistorySize;
+    int animationDurationMs;
+    int sidebarWidth;
+    int groupSplitSize;
+    QStringList groupKeepApart;     // 每条规则列出不宜同组的学生，姓名以顿号、逗号或空格分隔
+    QStringList groupKeepTogether;  // 每条规则列出需要同组的学生
+    QString scoreTeamAName;
+    QString scoreTeamBName;
+    bool collapseHidesToolWindows;
+    bool firstRunCompleted;
     QString seewoPath;
     QString classNote;
     QString siliconFlowApiKey;
-    QString siliconFlowModel = "Qwen/Qwen3-8B";
-    QString siliconFlowEndpoint = "https://api.siliconflow.cn/v1/chat/completions";
-    int floatingBallX = -1;
-    int floatingBallY = -1;
+    QString siliconFlowModel;
+    QString siliconFlowEndpoint;
+    int floatingBallX;
+    int floatingBallY;
     QStringList selfStudyPeriods;
-    int selfStudyIdleSeconds = 180;
-    bool screenOffShowQuote = true;
+    int selfStudyIdleSeconds;
+    bool screenOffShowQuote;
 
 private:
     Config();
+    ~Config();
+
+    bool loadSnapshot();
+    ConfigChange::Flags applyJsonRoot(const QJsonObject& root);
+    void applyExternal(const QJsonObject& root);
+    ConfigChange::Flags applyLists(RosterPtr roster, QVector<AppButton> buttons, bool buttonsNormalized);
+    QJsonObject toJson() const;
+    void publish(const QVector<AppButton>& buttons, const RosterPtr& roster);
+    RosterPtr activeRoster();
 
     QString m_configPath;
-    QVector<AppButton> m_buttons;
-    QStringList m_students;
+    std::unique_ptr<ConfigWriter> m_writer;
+    std::unique_ptr<ConfigNotifier> m_notifier;
+    std::unique_ptr<ConfigWatcher> m_watcher;
+    std::unique_ptr<ClassStore> m_classes;
+    RosterPtr m_configRoster;
+    ConfigSnapshotPtr m_snapshot = std::make_shared<const ConfigSnapshot>();
+    std::atomic<quint64> m_generation{0};
 };
 
 class Logger {
@@ -0,0 +1,527 @@
+#include "Xlsx.h"
+
+#include <QByteArray>
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+#include <QXmlStreamReader>
+
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace {
+constexpr quint32 kLocalHeaderSig = 0x04034b50;
+constexpr quint32 kCentralHeaderSig = 0x02014b50;
+constexpr quint32 kEndOfCentralDirSig = 0x06054b50;
+constexpr int kWindowSize = 1 << 15;
+constexpr int kFastBits = 10;
+
+quint16 readU16(const uchar* p) {
+    return quint16(p[0] | (p[1] << 8));
+}
+
+quint32 readU32(const uchar* p) {
+    return quint32(p[0]) | (quint32(p[1]) << 8) | (quint32(p[2]) << 16) | (quint32(p[3]) << 24);
+}
+
+// xl/worksheets/sheetN.xml 中的 N；其他形式的部件名返回 -1。
+int worksheetNumber(const QString& part) {
+    const QLatin1String prefix("xl/worksheets/sheet");
+    const QLatin1String suffix(".xml");
+    if (!part.startsWith(prefix) || !part.endsWith(suffix)) return -1;
+    bool ok = false;
+    const int number = part.midRef(prefix.size(), part.size() - prefix.size() - suffix.size()).toInt(&ok);
+    return ok && number >= 0 ? number : -1;
+}
+
+struct ZipEntry {
+    quint16 method = 0;
+    quint32 crc = 0;
+    quint32 compressedSize = 0;
+    quint32 size = 0;
+    quint32 localOffset = 0;
+};
+
+// 只读中央目录，不扫描本地文件头；不支持 ZIP64 与加密条目。
+bool readCentralDirectory(const uchar* data, qint64 size, QHash<QString, ZipEntry>* entries) {
+    if (size < 22) return false;
+    const qint64 lowest = qMax<qint64>(0, size - 22 - 0xFFFF);
+    qint64 eocd = -1;
+    for (qint64 i = size - 22; i >= lowest; --i) {
+        if (readU32(data + i) == kEndOfCentralDirSig) {
+            eocd = i;
+            break;
+        }
+    }
+    if (eocd < 0) return false;
+
+    const int count = readU16(data + eocd + 10);
+    qint64 p = readU32(data + eocd + 16);
+    for (int i = 0; i < count; ++i) {
+        if (p + 46 > size || readU32(data + p) != kCentralHeaderSig) return false;
+        const uchar* h = data + p;
+        const int nameLen = readU16(h + 28);
+        const int extraLen = readU16(h + 30);
+        const int commentLen = readU16(h + 32);
+        if (p + 46 + nameLen > size) return false;
+
+        ZipEntry entry;
+        entry.method = readU16(h + 10);
+        entry.crc = readU32(h + 16);
+        entry.compressedSize = readU32(h + 20);
+        entry.size = readU32(h + 24);
+        entry.localOffset = readU32(h + 42);
+        if (!(readU16(h + 8) & 0x1)) {
+            entries->insert(QString::fromUtf8(reinterpret_cast<const char*>(h + 46), nameLen), entry);
+        }
+        p += 46 + nameLen + extraLen + commentLen;
+    }
+    return true;
+}
+
+// 规范 Huffman 码：短码走 kFastBits 位查表，长码按 count/symbol 逐位解码。
+struct Huffman {
+    quint16 count[16];
+    quint16 symbol[288];
+    quint16 fast[1 << kFastBits];  // (码长 << 9) | 符号，0 表示需要慢路径
+
+    bool build(const quint8* lengths, int n) {
+        std::memset(count, 0, sizeof(count));
+        std::memset(fast, 0, sizeof(fast));
+        for (int i = 0; i < n; ++i) ++count[lengths[i]];
+        count[0] = 0;
+
+        int left = 1;
+        for (int len = 1; len < 16; ++len) {
+            left = (left << 1) - count[len];
+            if (left < 0) return false;
+        }
+
+        quint16 offsets[16];
+        quint16 nextCode[16];
+        offsets[1] = 0;
+        nextCode[1] = 0;
+        for (int len = 1; len < 15; ++len) {
+            offsets[len + 1] = offsets[len] + count[len];
+            nextCode[len + 1] = quint16((nextCode[len] + count[len]) << 1);
+        }
+        for (int i = 0; i < n; ++i) {
+            const int len = lengths[i];
+            if (!len) continue;
+            symbol[offsets[len]++] = quint16(i);
+            const int code = nextCode[len]++;
+            if (len > kFastBits) continue;
+            int reversed = 0;
+            for (int b = 0; b < len; ++b) reversed |= ((code >> b) & 1) << (len - 1 - b);
+            for (int k = reversed; k < (1 << kFastBits); k += 1 << len) fast[k] = quint16((len << 9) | i);
+        }
+        return true;
+    }
+};
+
+const quint16 kLengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const quint8 kLengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const quint16 kDistBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129,
+                               193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+const quint8 kDistExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6,
+                               6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// RFC 1951 解压。输出经 32KB 环形窗口按块交给 sink，不保留完整解压结果。
+class Inflater {
+public:
+    using Sink = std::function<void(const char*, int)>;
+
+    Inflater(const uchar* in, qint64 size, Sink sink) : m_in(in), m_size(size), m_sink(std::move(sink)) {}
+
+    bool run() {
+        bool last = false;
+        while (!last) {
+            if (!need(3)) return false;
+            last = take(1);
+            const int type = take(2);
+            bool ok = false;
+            if (type == 0) {
+                ok = stored();
+            } else if (type == 1) {
+                ok = fixedBlock();
+            } else if (type == 2) {
+                ok = dynamicBlock();
+            }
+            if (!ok) return false;
+        }
+        flush();
+        return true;
+    }
+
+private:
+    bool need(int n) {
+        while (m_bitCount < n) {
+            if (m_pos >= m_size) return false;
+            m_bits |= quint64(m_in[m_pos++]) << m_bitCount;
+            m_bitCount += 8;
+        }
+        return true;
+    }
+
+    void refill() {
+        while (m_bitCount <= 56 && m_pos < m_size) {
+            m_bits |= quint64(m_in[m_pos++]) << m_bitCount;
+            m_bitCount += 8;
+        }
+    }
+
+    int take(int n) {
+        const int value = int(m_bits & ((quint64(1) << n) - 1));
+        m_bits >>= n;
+        m_bitCount -= n;
+        return value;
+    }
+
+    int decode(const Huffman& h) {
+        refill();
+        const quint16 entry = h.fast[m_bits & ((1 << kFastBits) - 1)];
+        if (entry) {
+            const int len = entry >> 9;
+            if (len > m_bitCount) return -1;
+            take(len);
+            return entry & 0x1FF;
+        }
+        int code = 0;
+        int first = 0;
+        int index = 0;
+        for (int len = 1; len < 16; ++len) {
+            if (!need(1)) return -1;
+            code |= take(1);
+            const int count = h.count[len];
+            if (code - count < first) return h.symbol[index + (code - first)];
+            index += count;
+            first = (first + count) << 1;
+            code <<= 1;
+        }
+        return -1;
+    }
+
+    void put(uchar c) {
+        m_window[m_out & (kWindowSize - 1)] = c;
+        ++m_out;
+        if ((m_out & (kWindowSize - 1)) == 0) flush();
+    }
+
+    void flush() {
+        const qint64 start = m_flushed & (kWindowSize - 1);
+        const int n = int(m_out - m_flushed);
+        if (n > 0) m_sink(reinterpret_cast<const char*>(m_window + start), n);
+        m_flushed = m_out;
+    }
+
+    bool stored() {
+        take(m_bitCount & 7);
+        if (!need(32)) return false;
+        const int len = take(16);
+        const int nlen = take(16);
+        if (len != (~nlen & 0xFFFF)) return false;
+        for (int i = 0; i < len; ++i) {
+            if (!need(8)) return false;
+            put(uchar(take(8)));
+        }
+        return true;
+    }
+
+    bool codes(const Huffman& lengthCode, const Huffman& distCode) {
+        for (;;) {
+            const int sym = decode(lengthCode);
+            if (sym < 0) return false;
+            if (sym < 256) {
+                put(uchar(sym));
+                continue;
+            }
+            if (sym == 256) return true;
+
+            const int li = sym - 257;
+            if (li >= 29 || !need(kLengthExtra[li])) return false;
+            const int len = kLengthBase[li] + take(kLengthExtra[li]);
+            const int di = decode(distCode);
+            if (di < 0 || di >= 30 || !need(kDistExtra[di])) return false;
+            const int dist = kDistBase[di] + take(kDistExtra[di]);
+            if (dist > m_out) return false;
+            for (int i = 0; i < len; ++i) put(m_window[(m_out - dist) & (kWindowSize - 1)]);
+        }
+    }
+
+    bool fixedBlock() {
+        static const auto tables = []() {
+            struct Fixed {
+                Huffman lengths;
+                Huffman distances;
+            } fixed;
+            quint8 l[288];
+            int i = 0;
+            for (; i < 144; ++i) l[i] = 8;
+            for (; i < 256; ++i) l[i] = 9;
+            for (; i < 280; ++i) l[i] = 7;
+            for (; i < 288; ++i) l[i] = 8;
+            fixed.lengths.build(l, 288);
+            for (i = 0; i < 30; ++i) l[i] = 5;
+            fixed.distances.build(l, 30);
+            return fixed;
+        }();
+        return codes(tables.lengths, tables.distances);
+    }
+
+    bool dynamicBlock() {
+        static const quint8 order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+        if (!need(14)) return false;
+        const int nlen = take(5) + 257;
+        const int ndist = take(5) + 1;
+        const int ncode = take(4) + 4;
+        if (nlen > 286 || ndist > 30) return false;
+
+        quint8 lengths[320] = {};
+        for (int i = 0; i < ncode; ++i) {
+            if (!need(3)) return false;
+            lengths[order[i]] = quint8(take(3));
+        }
+        if (!m_lengthCode.build(lengths, 19)) return false;
+
+        int index = 0;
+        while (index < nlen + ndist) {
+            int sym = decode(m_lengthCode);
+            if (sym < 0) return false;
+            if (sym < 16) {
+                lengths[index++] = quint8(sym);
+                continue;
+            }
+            quint8 value = 0;
+            int repeat = 0;
+            if (sym == 16) {
+                if (index == 0 || !need(2)) return false;
+                value = lengths[index - 1];
+                repeat = 3 + take(2);
+            } else if (sym == 17) {
+                if (!need(3)) return false;
+                repeat = 3 + take(3);
+            } else {
+                if (!need(7)) return false;
+                repeat = 11 + take(7);
+            }
+            if (index + repeat > nlen + ndist) return false;
+            while (repeat--) lengths[index++] = value;
+        }
+        if (lengths[256] == 0) return false;
+        if (!m_lengthCode.build(lengths, nlen) || !m_distCode.build(lengths + nlen, ndist)) return false;
+        return codes(m_lengthCode, m_distCode);
+    }
+
+    const uchar* m_in;
+    qint64 m_size;
+    qint64 m_pos = 0;
+    quint64 m_bits = 0;
+    int m_bitCount = 0;
+    Sink m_sink;
+    uchar m_window[kWindowSize];
+    qint64 m_out = 0;
+    qint64 m_flushed = 0;
+    Huffman m_lengthCode;
+    Huffman m_distCode;
+};
+
+bool extract(const uchar* data, qint64 size, const ZipEntry& entry, const Inflater::Sink& sink) {
+    const qint64 local = entry.localOffset;
+    if (local + 30 > size || readU32(data + local) != kLocalHeaderSig) return false;
+    const qint64 begin = local + 30 + readU16(data + local + 26) + readU16(data + local + 28);
+    if (begin + entry.compressedSize > size) return false;
+
+    quint32 crc = 0;
+    qint64 produced = 0;
+    const auto checked = [&](const char* chunk, int n) {
+        crc = Xlsx::crc32(crc, chunk, n);
+        produced += n;
+        sink(chunk, n);
+    };
+
+    if (entry.method == 0) {
+        checked(reinterpret_cast<const char*>(data + begin), int(entry.compressedSize));
+    } else if (entry.method == 8) {
+        // 窗口约 32KB，放在堆上避免占用 UI 线程栈。
+        auto inflater = std::make_unique<Inflater>(data + begin, entry.compressedSize, checked);
+        if (!inflater->run()) return false;
+    } else {
+        return false;
+    }
+    return produced == entry.size && crc == entry.crc;
+}
+
+// 增量解析：每收到一块解压数据就推进到当前缓冲末尾，PrematureEndOfDocument 表示等待下一块。
+template <typename Handler>
+bool parseXml(const uchar* data, qint64 size, const ZipEntry& entry, Handler handler) {
+    QXmlStreamReader xml;
+    bool ok = true;
+    const bool extracted = extract(data, size, entry, [&](const char* chunk, int n) {
+        if (!ok) return;
+        xml.addData(QByteArray(chunk, n));
+        while (!xml.atEnd()) {
+            xml.readNext();
+            if (xml.hasError()) {
+                if (xml.error() != QXmlStreamReader::PrematureEndOfDocumentError) ok = false;
+                break;
+            }
+            handler(xml);
+        }
+    });
+    return extracted && ok;
+}
+
+int columnIndex(const QStringRef& ref) {
+    int column = 0;
+    for (const QChar c : ref) {
+        const ushort u = c.unicode();
+        if (u < 'A' || u > 'Z') break;
+        column = column * 26 + (u - 'A' + 1);
+    }
+    return column - 1;
+}
+
+bool isNameHeader(const QString& text) {
+    return text == QStringLiteral("姓名") || text == QStringLiteral("名字") || text == QStringLiteral("学生姓名")
+        || text.compare(QLatin1String("name"), Qt::CaseInsensitive) == 0;
+}
+}  // namespace
+
+quint32 Xlsx::crc32(quint32 crc, const char* data, qint64 size) {
+    static const auto table = []() {
+        QVector<quint32> t(256);
+        for (quint32 i = 0; i < 256; ++i) {
+            quint32 c = i;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[int(i)] = c;
+        }
+        return t;
+    }();
+    crc = ~crc;
+    for (qint64 i = 0; i < size; ++i) {
+        crc = table[int((crc ^ uchar(data[i])) & 0xFF)] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+bool Xlsx::readRoster(const uchar* data, qint64 size, const std::function<void(const QString&)>& emitName,
+                      QString* errorMessage) {
+    const auto fail = [errorMessage](const QString& message) {
+        if (errorMessage) *errorMessage = message;
+        return false;
+    };
+
+    QHash<QString, ZipEntry> entries;
+    if (!readCentralDirectory(data, size, &entries)) {
+        return fail("Excel 文件已损坏或不是 .xlsx 格式。");
+    }
+
+    QString sheetName = QStringLiteral("xl/worksheets/sheet1.xml");
+    if (!entries.contains(sheetName)) {
+        // 按序号取第一个工作表：sheet2.xml 排在 sheet10.xml 之前。
+        sheetName.clear();
+        int best = -1;
+        for (auto it = entries.cbegin(); it != entries.cend(); ++it) {
+            const int number = worksheetNumber(it.key());
+            if (number >= 0 && (best < 0 || number < best)) {
+                best = number;
+                sheetName = it.key();
+            }
+        }
+        if (sheetName.isEmpty()) return fail("Excel 文件中没有工作表。");
+    }
+
+    QVector<QString> shared;
+    const auto sharedEntry = entries.constFind(QStringLiteral("xl/sharedStrings.xml"));
+    if (sharedEntry != entries.constEnd()) {
+        QString current;
+        bool inText = false;
+        int phoneticDepth = 0;
+        const bool ok = parseXml(data, size, *sharedEntry, [&](QXmlStreamReader& xml) {
+            if (xml.isStartElement()) {
+                const QStringRef name = xml.name();
+                if (name == QLatin1String("rPh")) ++phoneticDepth;
+                else if (name == QLatin1String("t")) inText = phoneticDepth == 0;
+                else if (name == QLatin1String("si")) current.clear();
+            } else if (xml.isEndElement()) {
+                const QStringRef name = xml.name();
+                if (name == QLatin1String("rPh")) --phoneticDepth;
+                else if (name == QLatin1String("t")) inText = false;
+                else if (name == QLatin1String("si")) shared.append(current);
+            } else if (inText && xml.isCharacters()) {
+                current += xml.text();
+            }
+        });
+        if (!ok) return fail("Excel 共享字符串表解析失败。");
+    }
+
+    struct Cell {
+        int column;
+        QString text;
+        bool isText;
+    };
+    QVector<Cell> row;
+    int nameColumn = -1;
+    bool headerChecked = false;
+    int cellColumn = 0;
+    QString cellType;
+    QString cellText;
+    bool inValue = false;
+
+    const auto finishRow = [&]() {
+        if (row.isEmpty()) return;
+        if (!headerChecked) {
+            headerChecked = true;
+            for (const Cell& cell : row) {
+                if (isNameHeader(cell.text.trimmed())) {
+                    nameColumn = cell.column;
+                    row.clear();
+                    return;
+                }
+            }
+        }
+        for (const Cell& cell : row) {
+            if (nameColumn >= 0 ? cell.column == nameColumn : cell.isText) emitName(cell.text);
+        }
+        row.clear();
+    };
+
+    const bool ok = parseXml(data, size, entries.value(sheetName), [&](QXmlStreamReader& xml) {
+        if (xml.isStartElement()) {
+            const QStringRef name = xml.name();
+            if (name == QLatin1String("c")) {
+                const QXmlStreamAttributes attrs = xml.attributes();
+                cellColumn = columnIndex(attrs.value(QLatin1String("r")));
+                if (cellColumn < 0) cellColumn = row.isEmpty() ? 0 : row.last().column + 1;
+                cellType = attrs.value(QLatin1String("t")).toString();
+                cellText.clear();
+            } else if (name == QLatin1String("v") || name == QLatin1String("t")) {
+                inValue = true;
+            }
+        } else if (xml.isEndElement()) {
+            const QStringRef name = xml.name();
+            if (name == QLatin1String("v") || name == QLatin1String("t")) {
+                inValue = false;
+            } else if (name == QLatin1String("c")) {
+                if (cellType == QLatin1String("s")) {
+                    bool isIndex = false;
+                    const int index = cellText.toInt(&isIndex);
+                    if (isIndex && index >= 0 && index < shared.size()) row.append({cellColumn, shared.at(index), true});
+                } else if (!cellText.isEmpty()) {
+                    const bool isText = cellType == QLatin1String("inlineStr") || cellType == QLatin1String("str");
+                    row.append({cellColumn, cellText, isText});
+                }
+            } else if (name == QLatin1String("row")) {
+                finishRow();
+            }
+        } else if (inValue && xml.isCharacters()) {
+            cellText += xml.text();
+        }
+    });
+    finishRow();
+    if (!ok) return fail("Excel 工作表解析失败。");
+    return true;
+}
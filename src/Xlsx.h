@@ -0,0 +1,16 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+
+#include <functional>
+
+// 不依赖第三方库的最小 XLSX 支持：ZIP 中央目录、inflate 解压与流式 XML 解析。
+// 工作表按块解压后直接送入 QXmlStreamReader，内存占用只与共享字符串表大小相关。
+namespace Xlsx {
+quint32 crc32(quint32 crc, const char* data, qint64 size);
+
+// 逐行读取第一个工作表。首行含“姓名”等表头时只取该列，否则取每行所有文本单元格。
+bool readRoster(const uchar* data, qint64 size, const std::function<void(const QString&)>& emitName,
+                QString* errorMessage = nullptr);
+}
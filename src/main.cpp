@@ -10,8 +10,14 @@
 #include <QScreen>
 #include <QStyle>
 #include <QSystemTrayIcon>
-#include <QTimer>
 
+#include "AttendanceStats.h"
+#include "DrawAudit.h"
+#include "DrawEngine.h"
+#include "PointsLedger.h"
+#include "Random.h"
+#include "RosterImport.h"
+#include "Timetable.h"
 #include "Utils.h"
 #include "ui/FloatingBall.h"
 #include "ui/FluentTheme.h"
@@ -44,6 +50,33 @@ int main(int argc, char* argv[]) {
 
     Logger::instance().info("程序启动");
 
+    Rng::initSession(app.arguments());
+
+    // 性能自检与抽取审计：只做计算并写入日志，不启动界面。
+    if (app.arguments().contains("--bench-draws")) {
+        DrawEngine::benchmark(10000, 1000000);
+        return 0;
+    }
+    if (app.arguments().contains("--bench-config")) {
+        Config::benchmark(3000, 50);
+        return 0;
+    }
+    if (app.arguments().contains("--bench-attendance")) {
+        AttendanceMatrix::benchmark(3000, 200);
+        return 0;
+    }
+    if (app.arguments().contains("--bench-import")) {
+        RosterImporter::benchmark(30000, 20);
+        return 0;
+    }
+    if (app.arguments().contains("--bench-points")) {
+        PointsLedger::benchmark(2000, 200000);
+        return 0;
+    }
+    if (app.arguments().contains("--audit-draws")) {
+        return DrawAudit::run(app.arguments());
+    }
+
     if (!Config::instance().firstRunCompleted) {
         FirstRunWizard wizard;
         wizard.exec();
@@ -78,6 +111,7 @@ int main(int argc, char* argv[]) {
 
     QObject::connect(&app, &QCoreApplication::aboutToQuit, [&]() {
         AppState::setQuitting(true);
+        Config::instance().flush();
         Logger::instance().info("程序退出");
     });
 
@@ -104,6 +138,8 @@ int main(int argc, char* argv[]) {
     auto* actionRandomCall = menu->addAction("快速打开：随机点名");
     auto* actionAiAssistant = menu->addAction("快速打开：AI 助手");
     auto* actionOpenSettings = menu->addAction("打开设置");
+    auto* classMenu = menu->addMenu("切换班级");
+    classMenu->setStyleSheet(FluentTheme::trayMenuStyle());
     menu->addSeparator();
     auto* actionQuit = menu->addAction("退出程序");
 
@@ -114,6 +150,7 @@ int main(int argc, char* argv[]) {
     QObject::connect(actionRandomCall, &QAction::triggered, [sidebar]() { sidebar->triggerTool("RANDOM_CALL"); });
     QObject::connect(actionAiAssistant, &QAction::triggered, [sidebar]() { sidebar->triggerTool("AI_ASSISTANT"); });
     QObject::connect(actionOpenSettings, &QAction::triggered, [sidebar]() { sidebar->openSettings(); });
+    QObject::connect(classMenu, &QMenu::aboutToShow, [sidebar, classMenu]() { sidebar->fillClassMenu(classMenu); });
     QObject::connect(actionQuit, &QAction::triggered, [&]() { AppState::setQuitting(true); app.quit(); });
 
     tray->show();
@@ -127,36 +164,14 @@ int main(int argc, char* argv[]) {
         }
     });
 
-    QString triggeredStudyKey;
-    QTimer studyTimer;
-    studyTimer.setInterval(10000);
-    QObject::connect(&studyTimer, &QTimer::timeout, [&]() {
-        const QTime now = QTime::currentTime();
-        QString currentKey;
-        for (const QString& period : Config::instance().selfStudyPeriods) {
-            const QStringList parts = period.split('-', Qt::SkipEmptyParts);
-            if (parts.size() != 2) continue;
-            const QTime s = QTime::fromString(parts[0].trimmed(), "HH:mm");
-            const QTime e = QTime::fromString(parts[1].trimmed(), "HH:mm");
-            if (!s.isValid() || !e.isValid()) continue;
-            if (now >= s && now <= e) {
-                currentKey = QDate::currentDate().toString(Qt::ISODate) + "|" + period;
-                break;
-            }
-        }
-
-        if (currentKey.isEmpty()) {
-            triggeredStudyKey.clear();
-            return;
-        }
-
-        if (triggeredStudyKey != currentKey) {
-            triggeredStudyKey = currentKey;
-            sidebar->triggerTool("SCREEN_OFF");
-            Logger::instance().info("根据自习时段自动进入息屏");
-        }
-    });
-    studyTimer.start();
+    // 进入自习时段时自动息屏，每个时段只触发一次；启动时已在时段内同样触发。
+    TimetableMonitor& timetable = TimetableMonitor::instance();
+    const auto enterSelfStudy = [&]() {
+        sidebar->triggerTool("SCREEN_OFF");
+        Logger::instance().info("根据自习时段自动进入息屏");
+    };
+    QObject::connect(&timetable, &TimetableMonitor::periodStarted, enterSelfStudy);
+    if (timetable.current()) enterSelfStudy();
 
     ball->restoreSavedPosition();
     if (Config::instance().startCollapsed) ball->show();
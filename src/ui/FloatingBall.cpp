@@ -24,6 +24,17 @@ FloatingBall::FloatingBall(QWidget* parent) : QWidget(parent) {
     shadow->setColor(QColor(0, 0, 0, 95));
     setGraphicsEffect(shadow);
     restoreSavedPosition();
+
+    connect(Config::instance().notifier(), &ConfigNotifier::changed, this, [this](ConfigChange::Flags changes) {
+        const auto& cfg = Config::instance();
+        if (changes.testFlag(ConfigChange::BallSize)) {
+            setFixedSize(cfg.floatingBallSize, cfg.floatingBallSize);
+            snapToScreenEdge();
+        }
+        if (changes.testFlag(ConfigChange::BallOpacity)) {
+            setWindowOpacity(cfg.floatingOpacity / 100.0);
+        }
+    });
 }
 
 bool FloatingBall::event(QEvent* event) {
@@ -0,0 +1,191 @@
+#include "RollingNameView.h"
+
+#include <QPainter>
+#include <QPainterPath>
+#include <QVariantAnimation>
+
+#include <algorithm>
+
+namespace {
+constexpr int kColumns = 5;
+constexpr qint64 kSlowFrameNs = 25 * 1000 * 1000;
+
+int fontPixelSize(int slots) {
+    return slots == 1 ? 42 : (slots <= 4 ? 32 : 24);
+}
+}
+
+RollingNameView::RollingNameView(QWidget* parent) : QWidget(parent), m_roster(std::make_shared<const Roster>()) {
+    setMinimumHeight(120);
+    m_font = font();
+    m_font.setWeight(QFont::Black);
+    m_font.setPixelSize(fontPixelSize(m_slotCount));
+    m_previous.reserve(m_slotCount);
+    m_current.reserve(m_slotCount);
+
+    // 动画帧由 Qt 的统一动画定时器驱动，与屏幕刷新节奏对齐。
+    m_scroll = new QVariantAnimation(this);
+    m_scroll->setStartValue(0.0);
+    m_scroll->setEndValue(1.0);
+    m_scroll->setEasingCurve(QEasingCurve::OutCubic);
+    connect(m_scroll, &QVariantAnimation::valueChanged, this, [this](const QVariant& value) {
+        m_progress = value.toReal();
+        update();
+    });
+    m_frameClock.start();
+}
+
+void RollingNameView::setRoster(const RosterPtr& roster) {
+    m_roster = roster ? roster : std::make_shared<const Roster>();
+    m_previous.clear();
+    m_current.clear();
+    rebuildCache();
+    update();
+}
+
+void RollingNameView::setSlotCount(int count) {
+    count = qMax(1, count);
+    if (count == m_slotCount) return;
+    m_slotCount = count;
+    m_previous.reserve(count);
+    m_current.reserve(count);
+    m_font.setPixelSize(fontPixelSize(count));
+    rebuildCache();
+    update();
+}
+
+void RollingNameView::rebuildCache() {
+    m_texts.resize(m_roster->size());
+    for (StudentId id = 0; id < m_roster->size(); ++id) {
+        QStaticText& text = m_texts[id];
+        text.setTextFormat(Qt::PlainText);
+        text.setPerformanceHint(QStaticText::AggressiveCaching);
+        text.setText(m_roster->name(id));
+        text.prepare(QTransform(), m_font);
+    }
+    m_message.setTextFormat(Qt::PlainText);
+    m_message.setText(m_messageText);
+    m_message.prepare(QTransform(), m_font);
+}
+
+void RollingNameView::setMessage(const QString& text) {
+    m_scroll->stop();
+    m_previous.clear();
+    m_current.clear();
+    m_progress = 1.0;
+    if (text != m_messageText) {
+        m_messageText = text;
+        m_message.setText(text);
+        m_message.prepare(QTransform(), m_font);
+    }
+    update();
+}
+
+// 姓名 ID 复制进视图自己预留的缓冲区，不与调用方共享：调用方每帧原地清空重抽时不会因写时分离而重新分配。
+void RollingNameView::rollTo(const QVector<StudentId>& ids, int durationMs) {
+    m_previous.swap(m_current);
+    m_current.resize(ids.size());
+    std::copy(ids.cbegin(), ids.cend(), m_current.begin());
+    m_scroll->stop();
+    m_progress = 0.0;
+    m_scroll->setDuration(qMax(16, durationMs));
+    m_scroll->start();
+}
+
+void RollingNameView::showPicks(const QVector<StudentId>& ids) {
+    m_scroll->stop();
+    m_previous.clear();
+    m_current.resize(ids.size());
+    std::copy(ids.cbegin(), ids.cend(), m_current.begin());
+    m_progress = 1.0;
+    update();
+}
+
+QString RollingNameView::text() const {
+    if (m_current.isEmpty()) return m_messageText;
+    QStringList names;
+    for (const StudentId id : m_current) names.append(m_roster->name(id));
+    return names.join("、");
+}
+
+RollingNameView::FrameStats RollingNameView::frameStats() const {
+    FrameStats stats;
+    stats.frames = m_frames;
+    stats.averageMs = m_frames > 0 ? m_totalFrameNs / 1e6 / m_frames : 0.0;
+    stats.worstMs = m_worstFrameNs / 1e6;
+    stats.slowFrames = m_slowFrames;
+    return stats;
+}
+
+void RollingNameView::resetFrameStats() {
+    m_lastFrameNs = -1;
+    m_frames = 0;
+    m_totalFrameNs = 0;
+    m_worstFrameNs = 0;
+    m_slowFrames = 0;
+}
+
+QSize RollingNameView::sizeHint() const {
+    return QSize(480, 120);
+}
+
+QRectF RollingNameView::slotRect(int index) const {
+    const int columns = qMin(m_slotCount, kColumns);
+    const int rows = (m_slotCount + kColumns - 1) / kColumns;
+    const QRectF area = QRectF(rect()).adjusted(8, 8, -8, -8);
+    const qreal w = area.width() / columns;
+    const qreal h = area.height() / rows;
+    return QRectF(area.left() + (index % columns) * w, area.top() + (index / columns) * h, w, h);
+}
+
+void RollingNameView::paintEvent(QPaintEvent*) {
+    // 两次绘制之间的间隔即帧时间，只在滚动期间统计。
+    if (m_scroll->state() == QAbstractAnimation::Running) {
+        const qint64 nowNs = m_frameClock.nsecsElapsed();
+        if (m_lastFrameNs >= 0) {
+            const qint64 frameNs = nowNs - m_lastFrameNs;
+            ++m_frames;
+            m_totalFrameNs += frameNs;
+            m_worstFrameNs = qMax(m_worstFrameNs, frameNs);
+            if (frameNs > kSlowFrameNs) ++m_slowFrames;
+        }
+        m_lastFrameNs = nowNs;
+    } else {
+        m_lastFrameNs = -1;
+    }
+
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    QPainterPath background;
+    background.addRoundedRect(QRectF(rect()).adjusted(0.5, 0.5, -0.5, -0.5), 18, 18);
+    painter.fillPath(background, QColor("#ffffff"));
+    painter.setPen(QColor("#d8e0eb"));
+    painter.drawPath(background);
+
+    painter.setFont(m_font);
+    painter.setPen(QColor("#1f2d3d"));
+    if (m_current.isEmpty()) {
+        const QSizeF size = m_message.size();
+        painter.drawStaticText(QPointF(width() - size.width(), height() - size.height()) / 2, m_message);
+        return;
+    }
+
+    const qreal shift = 1.0 - m_progress;
+    for (int i = 0; i < m_current.size(); ++i) {
+        const QRectF slot = slotRect(i);
+        painter.save();
+        painter.setClipRect(slot);
+        const auto drawAt = [&](StudentId id, qreal dy) {
+            if (id < 0 || id >= m_texts.size()) return;
+            const QStaticText& text = m_texts.at(id);
+            const QSizeF size = text.size();
+            painter.drawStaticText(QPointF(slot.center().x() - size.width() / 2,
+                                           slot.center().y() - size.height() / 2 + dy),
+                                   text);
+        };
+        // 新名字从下方滚入，旧名字向上滚出。
+        drawAt(m_current.at(i), shift * slot.height());
+        if (shift > 0.0 && i < m_previous.size()) drawAt(m_previous.at(i), (shift - 1.0) * slot.height());
+        painter.restore();
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QFont>
+#include <QStaticText>
+#include <QVector>
+#include <QWidget>
+
+#include "../Roster.h"
+
+class QVariantAnimation;
+
+// 随机点名的滚动显示：名单里的姓名在换名单或换字号时一次性排版成 QStaticText，
+// 滚动时每帧只改变位移并重绘；多个名额在同一次 paintEvent 中绘制。
+class RollingNameView : public QWidget {
+    Q_OBJECT
+public:
+    struct FrameStats {
+        int frames = 0;
+        double averageMs = 0.0;
+        double worstMs = 0.0;
+        int slowFrames = 0;  // 超过 25ms 的帧
+    };
+
+    explicit RollingNameView(QWidget* parent = nullptr);
+
+    void setRoster(const RosterPtr& roster);
+    void setSlotCount(int count);
+    void setMessage(const QString& text);
+    void rollTo(const QVector<StudentId>& ids, int durationMs);
+    void showPicks(const QVector<StudentId>& ids);
+    QString text() const;
+
+    FrameStats frameStats() const;
+    void resetFrameStats();
+
+    QSize sizeHint() const override;
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    void rebuildCache();
+    QRectF slotRect(int index) const;
+
+    RosterPtr m_roster;
+    QFont m_font;
+    QVector<QStaticText> m_texts;  // 按学生 ID 索引
+    QString m_messageText;
+    QStaticText m_message;
+    QVector<StudentId> m_previous;
+    QVector<StudentId> m_current;
+    QVariantAnimation* m_scroll;
+    qreal m_progress = 1.0;
+    int m_slotCount = 1;
+
+    QElapsedTimer m_frameClock;
+    qint64 m_lastFrameNs = -1;
+    int m_frames = 0;
+    qint64 m_totalFrameNs = 0;
+    qint64 m_worstFrameNs = 0;
+    int m_slowFrames = 0;
+};
@@ -0,0 +1,107 @@
+#include "RosterListModel.h"
+
+#include <QApplication>
+#include <QPainter>
+#include <QStyle>
+#include <QStyleOptionButton>
+
+namespace {
+constexpr int kRowHeight = 40;
+constexpr int kCheckSize = 18;
+}
+
+RosterListModel::RosterListModel(QObject* parent) : QAbstractListModel(parent), m_roster(std::make_shared<const Roster>()) {}
+
+void RosterListModel::setRoster(const RosterPtr& roster) {
+    beginResetModel();
+    m_roster = roster ? roster : std::make_shared<const Roster>();
+    m_rows.clear();
+    m_checked = m_roster->emptySet();
+    endResetModel();
+}
+
+void RosterListModel::setRows(const QVector<StudentId>& rows) {
+    beginResetModel();
+    m_rows = rows;
+    endResetModel();
+}
+
+StudentId RosterListModel::idAt(int row) const {
+    return row >= 0 && row < m_rows.size() ? m_rows.at(row) : -1;
+}
+
+const StudentSet& RosterListModel::checked() const {
+    return m_checked;
+}
+
+void RosterListModel::setChecked(const StudentSet& checked) {
+    if (checked.size() != m_roster->size() || checked == m_checked) return;
+    m_checked = checked;
+    notifyAllRows();
+}
+
+void RosterListModel::setVisibleChecked(bool checked) {
+    for (const StudentId id : m_rows) {
+        if (checked) m_checked.insert(id);
+        else m_checked.remove(id);
+    }
+    notifyAllRows();
+}
+
+void RosterListModel::toggle(const QModelIndex& index) {
+    const StudentId id = idAt(index.row());
+    if (id < 0) return;
+    if (m_checked.contains(id)) m_checked.remove(id);
+    else m_checked.insert(id);
+    emit dataChanged(index, index, {Qt::CheckStateRole});
+}
+
+void RosterListModel::notifyAllRows() {
+    if (m_rows.isEmpty()) return;
+    emit dataChanged(index(0), index(m_rows.size() - 1), {Qt::CheckStateRole});
+}
+
+int RosterListModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+QVariant RosterListModel::data(const QModelIndex& index, int role) const {
+    const StudentId id = idAt(index.row());
+    if (id < 0) return QVariant();
+    switch (role) {
+    case Qt::DisplayRole: return m_roster->name(id);
+    case Qt::CheckStateRole: return m_checked.contains(id) ? Qt::Checked : Qt::Unchecked;
+    case Qt::UserRole: return id;
+    default: return QVariant();
+    }
+}
+
+Qt::ItemFlags RosterListModel::flags(const QModelIndex& index) const {
+    return index.isValid() ? Qt::ItemIsEnabled | Qt::ItemNeverHasChildren : Qt::NoItemFlags;
+}
+
+void RosterItemDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const {
+    const bool checked = index.data(Qt::CheckStateRole).toInt() == Qt::Checked;
+    const QRect r = option.rect;
+    if (checked) {
+        painter->fillRect(r, QColor("#fff4e8"));
+    } else if (option.state & QStyle::State_MouseOver) {
+        painter->fillRect(r, QColor("#f3f7fc"));
+    }
+
+    QStyleOptionButton box;
+    box.rect = QRect(r.left() + 12, r.center().y() - kCheckSize / 2, kCheckSize, kCheckSize);
+    box.state = QStyle::State_Enabled | (checked ? QStyle::State_On : QStyle::State_Off);
+    QStyle* style = option.widget ? option.widget->style() : QApplication::style();
+    style->drawPrimitive(QStyle::PE_IndicatorCheckBox, &box, painter, option.widget);
+
+    painter->setFont(option.font);
+    painter->setPen(option.palette.color(QPalette::Text));
+    painter->drawText(r.adjusted(12 + kCheckSize + 12, 0, -8, 0), Qt::AlignVCenter | Qt::AlignLeft,
+                      index.data(Qt::DisplayRole).toString());
+}
+
+QSize RosterItemDelegate::sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const {
+    Q_UNUSED(index);
+    return QSize(option.rect.width(), kRowHeight);
+}
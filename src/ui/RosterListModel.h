@@ -0,0 +1,45 @@
+#pragma once
+
+#include <QAbstractListModel>
+#include <QStyledItemDelegate>
+#include <QVector>
+
+#include "../Roster.h"
+
+// 考勤名单模型：勾选状态保存在按学生 ID 索引的位集合中，行只是当前筛选结果的 ID 列表。
+// 批量勾选、清空只发出一次 dataChanged。
+class RosterListModel : public QAbstractListModel {
+    Q_OBJECT
+public:
+    explicit RosterListModel(QObject* parent = nullptr);
+
+    void setRoster(const RosterPtr& roster);
+    void setRows(const QVector<StudentId>& rows);
+    StudentId idAt(int row) const;
+
+    const StudentSet& checked() const;
+    void setChecked(const StudentSet& checked);
+    void setVisibleChecked(bool checked);
+    void toggle(const QModelIndex& index);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+private:
+    void notifyAllRows();
+
+    RosterPtr m_roster;
+    QVector<StudentId> m_rows;
+    StudentSet m_checked;
+};
+
+// 只绘制勾选框与姓名，行高固定，配合 setUniformItemSizes 使用。
+class RosterItemDelegate : public QStyledItemDelegate {
+    Q_OBJECT
+public:
+    using QStyledItemDelegate::QStyledItemDelegate;
+
+    void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+    QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+};
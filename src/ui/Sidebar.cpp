@@ -1,5 +1,10 @@
 #include "Sidebar.h"
 
+#include "../ClassStore.h"
+#include "../IdleMonitor.h"
+#include "../RosterImport.h"
+#include "../TimerWheel.h"
+#include "../Timetable.h"
 #include "../Utils.h"
 #include "FluentTheme.h"
 
@@ -7,7 +12,9 @@
 #include <QDesktopServices>
 #include <QEvent>
 #include <QFocusEvent>
+#include <QInputDialog>
 #include <QMap>
+#include <QMenu>
 #include <QMessageBox>
 #include <QMouseEvent>
 #include <QParallelAnimationGroup>
@@ -18,7 +25,6 @@
 #include <QScreen>
 #include <QSet>
 #include <QGraphicsDropShadowEffect>
-#include <QTime>
 #include <QUrl>
 #include <QtMath>
 #include <functional>
@@ -34,19 +40,6 @@ int orderIndex(const QString& target) {
     const int idx = kOrderedTargets.indexOf(target);
     return idx < 0 ? 999 : idx;
 }
-
-bool inSelfStudyPeriod() {
-    const QTime now = QTime::currentTime();
-    for (const QString& period : Config::instance().selfStudyPeriods) {
-        const QStringList parts = period.split('-', Qt::SkipEmptyParts);
-        if (parts.size() != 2) continue;
-        const QTime s = QTime::fromString(parts[0].trimmed(), "HH:mm");
-        const QTime e = QTime::fromString(parts[1].trimmed(), "HH:mm");
-        if (!s.isValid() || !e.isValid()) continue;
-        if (now >= s && now <= e) return true;
-    }
-    return false;
-}
 }
 
 Sidebar::Sidebar(QWidget* parent) : QWidget(parent) {
@@ -59,26 +52,41 @@ Sidebar::Sidebar(QWidget* parent) : QWidget(parent) {
         m_attendanceSummary->show();
     }
     m_attendanceSelector = new AttendanceSelectDialog();
+    m_attendanceStats = new AttendanceStatsDialog();
     m_randomCall = new RandomCallDialog();
     m_aiAssistant = new AIAssistantDialog();
     m_settings = new SettingsDialog();
     m_screenOff = new ScreenOffOverlay();
     connect(m_screenOff, &ScreenOffOverlay::exited, this, [this]() {
         m_attendanceSummary->setPinnedOnTop(false);
+        updateIdleWatch();
     });
 
-    connect(m_settings, &SettingsDialog::configChanged, this, &Sidebar::reloadConfig);
-    connect(m_attendanceSelector, &AttendanceSelectDialog::saved, m_attendanceSummary, &AttendanceSummaryWidget::applyAbsentees);
+    // 自习时段内、未息屏时监测无操作，超过设定时长自动重新息屏。
+    TimetableMonitor& timetable = TimetableMonitor::instance();
+    connect(&timetable, &TimetableMonitor::periodStarted, this, [this]() { updateIdleWatch(); });
+    connect(&timetable, &TimetableMonitor::periodEnded, this, [this]() { updateIdleWatch(); });
+    connect(&IdleMonitor::instance(), &IdleMonitor::idle, this, [this]() {
+        if (m_screenOff->isActive() || !TimetableMonitor::instance().current()) return;
+        Logger::instance().info(QString("自习时段内 %1 秒无操作，自动息屏").arg(Config::instance().selfStudyIdleSeconds));
+        handleFunctionAction("SCREEN_OFF");
+    });
 
-    m_idleTimer.setSingleShot(true);
-    connect(&m_idleTimer, &QTimer::timeout, this, &Sidebar::collapseMenu);
+    connect(Config::instance().notifier(), &ConfigNotifier::changed, this, &Sidebar::applyConfigChanges);
+    connect(m_attendanceSelector, &AttendanceSelectDialog::saved, m_attendanceSummary, &AttendanceSummaryWidget::applyAbsentees);
+    connect(m_attendanceSelector, &AttendanceSelectDialog::saved, m_attendanceStats, &AttendanceStatsDialog::applyToday);
+    connect(m_attendanceSelector, &AttendanceSelectDialog::statsRequested, this, [this]() {
+        m_attendanceStats->reloadIfStale();
+        showManagedWindow(m_attendanceStats);
+    });
 
     qApp->installEventFilter(this);
     rebuildUI();
+    updateIdleWatch();
 }
 
 QList<QWidget*> Sidebar::managedToolWindows() const {
-    return {m_attendanceSelector, m_randomCall, m_aiAssistant, m_settings, m_screenOff};
+    return {m_attendanceSelector, m_attendanceStats, m_randomCall, m_aiAssistant, m_settings, m_screenOff};
 }
 
 void Sidebar::showManagedWindow(QWidget* window) {
@@ -113,9 +121,9 @@ void Sidebar::rebuildUI() {
     m_buttons.clear();
     m_buttonExpandedPos.clear();
 
-    const auto buttons = Config::instance().getButtons();
+    const ConfigSnapshotPtr snap = Config::instance().snapshot();
     QMap<int, AppButton> ordered;
-    for (const auto& b : buttons) {
+    for (const auto& b : snap->buttons) {
         if (!isAllowedTarget(b.target)) continue;
         ordered.insert(orderIndex(b.target), b);
     }
@@ -130,11 +138,14 @@ void Sidebar::rebuildUI() {
         const QIcon icon(Config::instance().resolveIconPath(b.iconPath));
         if (!icon.isNull()) {
             btn->setIcon(icon);
-            btn->setIconSize(QSize(qMax(24, Config::instance().iconSize - 6), qMax(24, Config::instance().iconSize - 6)));
         } else {
             btn->setText(b.name.left(2));
         }
         connect(btn, &QPushButton::clicked, this, [this, b]() { onButtonTriggered(b.action, b.target); });
+        btn->setContextMenuPolicy(Qt::CustomContextMenu);
+        connect(btn, &QWidget::customContextMenuRequested, this, [this, btn](const QPoint& pos) {
+            showClassMenu(btn->mapToGlobal(pos));
+        });
         auto* shadow = new QGraphicsDropShadowEffect(btn);
         shadow->setBlurRadius(14);
         shadow->setOffset(0, 3);
@@ -143,6 +154,7 @@ void Sidebar::rebuildUI() {
         m_buttons.push_back(btn);
     }
 
+    refreshButtonIcons();
     refreshButtonLayout();
 }
 
@@ -163,12 +175,44 @@ void Sidebar::hideAllToolWindowsAnimated() {
     }
 }
 
-void Sidebar::reloadConfig() {
-    Config::instance().load();
-    rebuildUI();
-    m_attendanceSummary->resetDaily();
-    if (Config::instance().showAttendanceSummaryOnStart) m_attendanceSummary->show();
-    else m_attendanceSummary->hide();
+void Sidebar::applyConfigChanges(ConfigChange::Flags changes) {
+    if (changes.testFlag(ConfigChange::Buttons)) {
+        rebuildUI();
+    } else {
+        if (changes.testFlag(ConfigChange::IconSize)) refreshButtonIcons();
+        if (changes & (ConfigChange::BallSize | ConfigChange::RadialLayout)) refreshButtonLayout();
+    }
+
+    if (changes.testFlag(ConfigChange::Roster)) {
+        m_attendanceSelector->reloadRoster();
+        m_attendanceSummary->resetDaily();
+        if (m_randomCall->isVisible()) m_randomCall->startAnim();
+    } else if (changes.testFlag(ConfigChange::AttendanceSummary)) {
+        m_attendanceSummary->refreshUi();
+    }
+
+    if (changes.testFlag(ConfigChange::AttendanceSummary)) {
+        if (Config::instance().showAttendanceSummaryOnStart) m_attendanceSummary->show();
+        else m_attendanceSummary->hide();
+    }
+
+    if (changes.testFlag(ConfigChange::SelfStudy)) updateIdleWatch();
+}
+
+void Sidebar::updateIdleWatch() {
+    IdleMonitor& idle = IdleMonitor::instance();
+    if (!m_screenOff->isActive() && TimetableMonitor::instance().current()) {
+        idle.start(Config::instance().selfStudyIdleSeconds * 1000LL);
+    } else {
+        idle.stop();
+    }
+}
+
+void Sidebar::refreshButtonIcons() {
+    const int side = qMax(24, Config::instance().iconSize - 6);
+    for (auto* btn : m_buttons) {
+        if (!btn->icon().isNull()) btn->setIconSize(QSize(side, side));
+    }
 }
 
 void Sidebar::launchExecutableTarget(const QString& target) {
@@ -201,22 +245,27 @@ void Sidebar::handleFunctionAction(const QString& target) {
         if (m_screenOff->isActive()) {
             m_screenOff->deactivate();
             m_attendanceSummary->setPinnedOnTop(false);
-            QTimer::singleShot(80, this, [this]() { m_attendanceSummary->setPinnedOnTop(false); });
+            TimerWheel::instance().schedule(80, this, [this]() { m_attendanceSummary->setPinnedOnTop(false); });
             return;
         }
 
-        m_screenOff->activate(inSelfStudyPeriod());
-        for (int delayMs = 2000; delayMs <= 20000; delayMs += 2000) {
-            QTimer::singleShot(delayMs, this, [this]() {
-                if (!m_screenOff->isActive()) {
-                    return;
-                }
-                m_attendanceSummary->setPinnedOnTop(true);
-                m_attendanceSummary->show();
-                m_attendanceSummary->raise();
-                m_attendanceSummary->activateWindow();
-            });
-        }
+        m_screenOff->activate(TimetableMonitor::instance().current());
+        IdleMonitor::instance().stop();
+        // 息屏后的前 20 秒每 2 秒把考勤摘要重新置顶一次，用一个重复定时器代替十个单次定时器。
+        TimerWheel& wheel = TimerWheel::instance();
+        wheel.cancel(m_pinTimer);
+        m_pinRepeats = 0;
+        m_pinTimer = wheel.scheduleRepeating(2000, this, [this]() {
+            if (!m_screenOff->isActive() || ++m_pinRepeats >= 10) {
+                TimerWheel::instance().cancel(m_pinTimer);
+                m_pinTimer = 0;
+                if (!m_screenOff->isActive()) return;
+            }
+            m_attendanceSummary->setPinnedOnTop(true);
+            m_attendanceSummary->show();
+            m_attendanceSummary->raise();
+            m_attendanceSummary->activateWindow();
+        }, 100);
     } else if (target == "RANDOM_CALL") {
         m_randomCall->setWindowOpacity(1.0);
         m_randomCall->startAnim();
@@ -260,7 +309,7 @@ void Sidebar::expandMenu() {
 
 void Sidebar::collapseMenu() {
     if (!isVisible() || m_isAnimating) return;
-    m_idleTimer.stop();
+    stopIdleCountdown();
     animateButtons(false);
 }
 
@@ -281,7 +330,7 @@ void Sidebar::mousePressEvent(QMouseEvent* event) {
 
 bool Sidebar::eventFilter(QObject* watched, QEvent* event) {
     Q_UNUSED(watched);
-    if (!isVisible() || m_isAnimating) return QWidget::eventFilter(watched, event);
+    if (!isVisible() || m_isAnimating || QApplication::activePopupWidget()) return QWidget::eventFilter(watched, event);
 
     if (event->type() == QEvent::MouseButtonPress) {
         auto* mouseEvent = static_cast<QMouseEvent*>(event);
@@ -302,7 +351,16 @@ void Sidebar::focusOutEvent(QFocusEvent* event) {
 }
 
 void Sidebar::resetIdleCountdown() {
-    m_idleTimer.start(Config::instance().menuAutoCollapseSeconds * 1000);
+    stopIdleCountdown();
+    m_idleTimer = TimerWheel::instance().schedule(Config::instance().menuAutoCollapseSeconds * 1000, this, [this]() {
+        m_idleTimer = 0;
+        collapseMenu();
+    }, 500);
+}
+
+void Sidebar::stopIdleCountdown() {
+    TimerWheel::instance().cancel(m_idleTimer);
+    m_idleTimer = 0;
 }
 
 void Sidebar::onButtonTriggered(const QString& action, const QString& target) {
@@ -406,3 +464,45 @@ void Sidebar::animateButtons(bool expanding) {
     });
     group->start(QAbstractAnimation::DeleteWhenStopped);
 }
+
+void Sidebar::fillClassMenu(QMenu* menu) {
+    menu->clear();
+    const ClassStore& store = Config::instance().classes();
+    const QString activeId = store.activeId();
+    const auto addClass = [this, menu, &activeId](const QString& id, const QString& name) {
+        QAction* action = menu->addAction(name);
+        action->setCheckable(true);
+        action->setChecked(id == activeId);
+        connect(action, &QAction::triggered, this, [id]() { Config::instance().switchClass(id); });
+    };
+    addClass(QString(), "默认班级");
+    for (const ClassInfo& info : store.classes()) {
+        addClass(info.id, info.name);
+    }
+    menu->addSeparator();
+    connect(menu->addAction("从名单文件新建班级..."), &QAction::triggered, this, &Sidebar::createClassFromFile);
+}
+
+void Sidebar::showClassMenu(const QPoint& globalPos) {
+    stopIdleCountdown();
+    QMenu menu(this);
+    menu.setStyleSheet(FluentTheme::trayMenuStyle());
+    fillClassMenu(&menu);
+    menu.exec(globalPos);
+    if (isVisible()) resetIdleCountdown();
+}
+
+void Sidebar::createClassFromFile() {
+    bool ok = false;
+    const QString name = QInputDialog::getText(this, "新建班级", "班级名称：", QLineEdit::Normal, QString(), &ok).trimmed();
+    if (!ok || name.isEmpty()) return;
+
+    const QString path = FluentTheme::getStyledOpenFileName(this, "选择名单", "", "Roster Files (*.xlsx *.csv *.txt)");
+    if (path.isEmpty()) return;
+
+    QStringList names;
+    QString error;
+    if (!RosterImporter::read(path, &names, &error) || Config::instance().createClass(name, names).isEmpty()) {
+        QMessageBox::warning(this, "新建班级失败", error.isEmpty() ? "班级名单保存失败。" : error);
+    }
+}
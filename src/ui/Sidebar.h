@@ -3,11 +3,11 @@
 #include <QHash>
 #include <QList>
 #include <QPoint>
-#include <QTimer>
 #include <QWidget>
 
 #include "Tools.h"
 
+class QMenu;
 class QPushButton;
 class QEvent;
 class QFocusEvent;
@@ -25,12 +25,13 @@ public:
     bool isExpanded() const;
     void expandMenu();
     void collapseMenu();
+    void fillClassMenu(QMenu* menu);
 
 signals:
     void requestCollapseToBall();
 
 public slots:
-    void reloadConfig();
+    void applyConfigChanges(ConfigChange::Flags changes);
 
 protected:
     void resizeEvent(QResizeEvent* event) override;
@@ -41,6 +42,7 @@ protected:
 private:
     AttendanceSummaryWidget* m_attendanceSummary;
     AttendanceSelectDialog* m_attendanceSelector;
+    AttendanceStatsDialog* m_attendanceStats;
     RandomCallDialog* m_randomCall;
     AIAssistantDialog* m_aiAssistant;
     SettingsDialog* m_settings;
@@ -48,7 +50,9 @@ private:
 
     QList<QPushButton*> m_buttons;
     QHash<QPushButton*, QPoint> m_buttonExpandedPos;
-    QTimer m_idleTimer;
+    quint64 m_idleTimer = 0;
+    quint64 m_pinTimer = 0;
+    int m_pinRepeats = 0;
     QRect m_anchorGeometry;
     bool m_suppressToolHideOnce = false;
     bool m_isAnimating = false;
@@ -60,7 +64,12 @@ private:
     QList<QWidget*> managedToolWindows() const;
     void showManagedWindow(QWidget* window);
     void refreshButtonLayout();
+    void refreshButtonIcons();
     void resetIdleCountdown();
+    void stopIdleCountdown();
+    void updateIdleWatch();
     void onButtonTriggered(const QString& action, const QString& target);
     void animateButtons(bool expanding);
+    void showClassMenu(const QPoint& globalPos);
+    void createClassFromFile();
 };
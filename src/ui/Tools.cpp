@@ -1,5 +1,10 @@
 #include "Tools.h"
 
+#include "../AttendanceLog.h"
+#include "../CallStats.h"
+#include "../PointsLedger.h"
+#include "../TimerWheel.h"
+#include "../Timetable.h"
 #include "FluentTheme.h"
 
 #include <QApplication>
@@ -22,13 +27,13 @@
 #include <QUrl>
 #include <QGuiApplication>
 #include <QGridLayout>
+#include <QHeaderView>
 #include <QMessageBox>
 #include <QInputDialog>
 #include <QMouseEvent>
 #include <QPushButton>
 #include <QProcess>
 #include <QPropertyAnimation>
-#include <QRandomGenerator>
 #include <QRegularExpression>
 #include <QSet>
 #include <QScreen>
@@ -39,6 +44,8 @@
 #include <QTime>
 #include <QVBoxLayout>
 #include <functional>
+#include <limits>
+#include <utility>
 
 namespace {
 const char* kGithubRepoUrl = "https://github.com/WuYuhan2009/Classassistant/";
@@ -87,6 +94,15 @@ void decorateDialog(QDialog* dlg, const QString& title) {
     FluentTheme::decorateDialog(dlg, title);
 }
 
+template <typename T>
+void assignTracked(T& field, const T& value, ConfigChange::Flag flag, ConfigChange::Flags& changes) {
+    if (field == value) {
+        return;
+    }
+    field = value;
+    changes |= flag;
+}
+
 class DialogDragFilter : public QObject {
 public:
     explicit DialogDragFilter(QDialog* dialog) : QObject(dialog), m_dialog(dialog) {}
@@ -388,9 +404,13 @@ ScreenOffOverlay::ScreenOffOverlay(QWidget* parent) : QWidget(parent) {
     root->addSpacing(8);
     root->addLayout(bottomRow);
 
-    m_tickTimer = new QTimer(this);
-    connect(m_tickTimer, &QTimer::timeout, this, &ScreenOffOverlay::refreshClockAndProgress);
     connect(m_exitButton, &QPushButton::clicked, this, &ScreenOffOverlay::deactivate);
+    // 时段起止时立即刷新进度，不必等到下一个整分钟。
+    const auto refreshIfActive = [this]() {
+        if (isActive()) refreshClockAndProgress();
+    };
+    connect(&TimetableMonitor::instance(), &TimetableMonitor::periodStarted, this, refreshIfActive);
+    connect(&TimetableMonitor::instance(), &TimetableMonitor::periodEnded, this, refreshIfActive);
     connect(m_shutdownButton, &QPushButton::clicked, this, [this]() {
         if (QMessageBox::question(this, "确认关机", "确定要立即关机吗？") != QMessageBox::Yes) {
             return;
@@ -417,7 +437,7 @@ void ScreenOffOverlay::activate(bool fromSelfStudy) {
     show();
     raise();
 
-    QTimer::singleShot(250, this, [this, baseFlags]() {
+    TimerWheel::instance().schedule(250, this, [this, baseFlags]() {
         if (!isVisible()) return;
         setWindowFlags(baseFlags);
         show();
@@ -425,35 +445,28 @@ void ScreenOffOverlay::activate(bool fromSelfStudy) {
 
     loadDailyQuote();
     refreshClockAndProgress();
-    m_tickTimer->start(1000);
 }
 
 void ScreenOffOverlay::deactivate() {
-    m_tickTimer->stop();
+    TimerWheel::instance().cancel(m_refreshTimer);
+    m_refreshTimer = 0;
     hide();
     emit exited();
 }
 
 bool ScreenOffOverlay::currentSelfStudyPeriod(QDateTime* start, QDateTime* end) const {
-    const QTime now = QTime::currentTime();
-    for (const QString& p : Config::instance().selfStudyPeriods) {
-        const QStringList parts = p.split('-', Qt::SkipEmptyParts);
-        if (parts.size() != 2) continue;
-        const QTime s = QTime::fromString(parts[0].trimmed(), "HH:mm");
-        const QTime e = QTime::fromString(parts[1].trimmed(), "HH:mm");
-        if (!s.isValid() || !e.isValid()) continue;
-        if (now >= s && now <= e) {
-            const QDate d = QDate::currentDate();
-            if (start) *start = QDateTime(d, s);
-            if (end) *end = QDateTime(d, e);
-            return true;
-        }
-    }
-    return false;
+    Timetable::Period period;
+    if (!TimetableMonitor::instance().current(&period)) return false;
+    if (start) *start = period.start;
+    if (end) *end = period.end;
+    return true;
 }
 
 void ScreenOffOverlay::refreshClockAndProgress() {
-    m_timeLabel->setText(QTime::currentTime().toString("HH:mm"));
+    const QDateTime now = QDateTime::currentDateTime();
+    m_timeLabel->setText(now.time().toString("HH:mm"));
+    // 下一次有可见变化的时刻：整分钟时钟、剩余分钟数变化或进度百分比变化；时段起止由信号触发。
+    qint64 nextChangeMs = 60000 - (now.time().second() * 1000 + now.time().msec());
 
     QDateTime st, ed;
     const bool inStudy = currentSelfStudyPeriod(&st, &ed);
@@ -461,13 +474,27 @@ void ScreenOffOverlay::refreshClockAndProgress() {
     m_remainingLabel->setVisible(inStudy);
     if (inStudy) {
         const qint64 total = st.secsTo(ed);
-        const qint64 done = st.secsTo(QDateTime::currentDateTime());
+        const qint64 done = st.secsTo(now);
         const int percent = total <= 0 ? 100 : qBound(0, static_cast<int>((done * 100) / total), 100);
         m_progress->setValue(percent);
-        const qint64 left = qMax<qint64>(0, QDateTime::currentDateTime().secsTo(ed));
+        const qint64 left = qMax<qint64>(0, now.secsTo(ed));
         const qint64 leftMin = (left + 59) / 60;
         m_remainingLabel->setText(QString("还剩 %1 分钟").arg(leftMin));
+
+        const qint64 leftMs = now.msecsTo(ed);
+        if (leftMs > 0) nextChangeMs = qMin(nextChangeMs, (leftMs - 1) % 60000 + 1);
+        if (total > 0 && percent < 100) {
+            const qint64 nextPercentSecs = ((percent + 1) * total + 99) / 100;
+            nextChangeMs = qMin(nextChangeMs, qMax<qint64>(1, nextPercentSecs * 1000 - st.msecsTo(now)));
+        }
     }
+
+    TimerWheel& wheel = TimerWheel::instance();
+    wheel.cancel(m_refreshTimer);
+    m_refreshTimer = wheel.schedule(nextChangeMs, this, [this]() {
+        m_refreshTimer = 0;
+        if (isActive()) refreshClockAndProgress();
+    }, 250);
 }
 
 void ScreenOffOverlay::loadDailyQuote() {
@@ -569,26 +596,30 @@ void AttendanceSummaryWidget::syncDaily() {
 }
 
 void AttendanceSummaryWidget::resetDaily() {
-    m_lastResetDate = QDate::currentDate().toString(Qt::ISODate);
-    m_absentees.clear();
+    const QDate today = QDate::currentDate();
+    m_lastResetDate = today.toString(Qt::ISODate);
+    // 当天已保存过考勤时从历史记录恢复，重启或切换班级不会丢失。
+    const QStringList saved = AttendanceLog::instance().absentees(Config::instance().classes().activeId(), today);
+    m_absentees = Config::instance().snapshot()->roster->setOf(saved);
     refreshUi();
 }
 
-void AttendanceSummaryWidget::applyAbsentees(const QStringList& absentees) {
+void AttendanceSummaryWidget::applyAbsentees(const StudentSet& absentees) {
     syncDaily();
     m_absentees = absentees;
     refreshUi();
 }
 
 void AttendanceSummaryWidget::refreshUi() {
-    const int total = Config::instance().getStudentList().size();
-    const int absent = m_absentees.size();
-    const int present = qMax(0, total - absent);
+    const RosterPtr roster = Config::instance().snapshot()->roster;
+    const int total = roster->size();
+    const QStringList absentNames = roster->names(m_absentees);
+    const int present = qMax(0, total - absentNames.size());
 
     m_updateTime->setText(QString("更新时间：%1").arg(QDateTime::currentDateTime().toString("yyyy-MM-dd HH:mm:ss")));
     m_expectedValue->setText(QString::number(total));
     m_presentValue->setText(QString::number(present));
-    m_absentList->setText(QString("请假名单：%1").arg(m_absentees.isEmpty() ? "无" : m_absentees.join("、")));
+    m_absentList->setText(QString("请假名单：%1").arg(absentNames.isEmpty() ? "无" : absentNames.join("、")));
 
     setFixedWidth(Config::instance().attendanceSummaryWidth);
     adjustSize();
@@ -624,18 +655,19 @@ AttendanceSelectDialog::AttendanceSelectDialog(QWidget* parent) : QDialog(parent
     layout->addWidget(tip);
 
     m_searchEdit = new QLineEdit;
-    m_searchEdit->setPlaceholderText("搜索学生姓名...");
+    m_searchEdit->setPlaceholderText("搜索姓名、拼音或首字母（如 zs）...");
     connect(m_searchEdit, &QLineEdit::textChanged, this, &AttendanceSelectDialog::filterRoster);
     layout->addWidget(m_searchEdit);
 
-    m_roster = new QListWidget;
-    const auto students = Config::instance().getStudentList();
-    for (const auto& s : students) {
-        auto* item = new QListWidgetItem(s);
-        item->setCheckState(Qt::Unchecked);
-        m_roster->addItem(item);
-    }
-    layout->addWidget(m_roster, 1);
+    m_rosterModel = new RosterListModel(this);
+    m_rosterView = new QListView;
+    m_rosterView->setUniformItemSizes(true);
+    m_rosterView->setItemDelegate(new RosterItemDelegate(m_rosterView));
+    m_rosterView->setModel(m_rosterModel);
+    m_rosterView->setMouseTracking(true);
+    connect(m_rosterView, &QListView::clicked, m_rosterModel, &RosterListModel::toggle);
+    reloadRoster();
+    layout->addWidget(m_rosterView, 1);
 
     auto* actions = new QGridLayout;
     actions->setHorizontalSpacing(8);
@@ -645,9 +677,10 @@ AttendanceSelectDialog::AttendanceSelectDialog(QWidget* parent) : QDialog(parent
     auto* allPresentBtn = new QPushButton("全员到齐");
     auto* exportBtn = new QPushButton("导出缺勤");
     auto* aiSummaryBtn = new QPushButton("AI缺勤分析");
+    auto* statsBtn = new QPushButton("考勤统计");
     auto* saveBtn = new QPushButton("保存");
     auto* cancelBtn = new QPushButton("关闭");
-    for (auto* btn : {markAllBtn, clearAllBtn, allPresentBtn, exportBtn, aiSummaryBtn, saveBtn, cancelBtn}) {
+    for (auto* btn : {markAllBtn, clearAllBtn, allPresentBtn, exportBtn, aiSummaryBtn, statsBtn, saveBtn, cancelBtn}) {
         btn->setMinimumWidth(110);
     }
     markAllBtn->setStyleSheet(buttonStyleWarning());
@@ -655,6 +688,7 @@ AttendanceSelectDialog::AttendanceSelectDialog(QWidget* parent) : QDialog(parent
     allPresentBtn->setStyleSheet(buttonStyleSuccess());
     exportBtn->setStyleSheet(buttonStyleNeutral());
     aiSummaryBtn->setStyleSheet(buttonStylePrimary());
+    statsBtn->setStyleSheet(buttonStyleNeutral());
     saveBtn->setStyleSheet(buttonStylePrimary());
     cancelBtn->setStyleSheet(buttonStyleNeutral());
     actions->addWidget(markAllBtn, 0, 0);
@@ -663,35 +697,18 @@ AttendanceSelectDialog::AttendanceSelectDialog(QWidget* parent) : QDialog(parent
     actions->addWidget(exportBtn, 1, 0);
     actions->addWidget(aiSummaryBtn, 1, 1);
     actions->addWidget(saveBtn, 1, 2);
+    actions->addWidget(statsBtn, 2, 0);
     actions->addWidget(cancelBtn, 2, 2);
 
-    connect(markAllBtn, &QPushButton::clicked, [this]() {
-        for (int i = 0; i < m_roster->count(); ++i) {
-            auto* item = m_roster->item(i);
-            if (!item->isHidden()) {
-                item->setCheckState(Qt::Checked);
-            }
-        }
-    });
-    connect(clearAllBtn, &QPushButton::clicked, [this]() {
-        for (int i = 0; i < m_roster->count(); ++i) {
-            m_roster->item(i)->setCheckState(Qt::Unchecked);
-        }
-    });
+    connect(markAllBtn, &QPushButton::clicked, [this]() { m_rosterModel->setVisibleChecked(true); });
+    connect(clearAllBtn, &QPushButton::clicked, [this]() { m_rosterModel->setChecked(m_students->emptySet()); });
     connect(allPresentBtn, &QPushButton::clicked, [this]() {
-        for (int i = 0; i < m_roster->count(); ++i) {
-            m_roster->item(i)->setCheckState(Qt::Unchecked);
-        }
+        m_rosterModel->setChecked(m_students->emptySet());
         saveSelection();
     });
     connect(exportBtn, &QPushButton::clicked, this, &AttendanceSelectDialog::exportSelection);
     connect(aiSummaryBtn, &QPushButton::clicked, [this]() {
-        QStringList absentees;
-        for (int i = 0; i < m_roster->count(); ++i) {
-            if (m_roster->item(i)->checkState() == Qt::Checked) {
-                absentees.append(m_roster->item(i)->text());
-            }
-        }
+        const QStringList absentees = m_students->names(checkedStudents());
         const QString prompt = QString("今日缺勤名单：%1。请给出课堂组织建议和补偿作业建议。")
                                    .arg(absentees.isEmpty() ? "无" : absentees.join("、"));
         requestAiCompletion(this,
@@ -702,67 +719,295 @@ AttendanceSelectDialog::AttendanceSelectDialog(QWidget* parent) : QDialog(parent
                                 QMessageBox::information(this, online ? "AI缺勤分析" : "离线缺勤建议", out);
                             });
     });
+    connect(statsBtn, &QPushButton::clicked, this, &AttendanceSelectDialog::statsRequested);
     connect(saveBtn, &QPushButton::clicked, this, &AttendanceSelectDialog::saveSelection);
     connect(cancelBtn, &QPushButton::clicked, [this]() { smoothHide(this); });
     layout->addLayout(actions);
 }
 
+void AttendanceSelectDialog::reloadRoster() {
+    m_students = Config::instance().snapshot()->roster;
+    m_searchIndex = std::make_unique<RosterSearchIndex>(m_students);
+    m_rosterModel->setRoster(m_students);
+    const QStringList saved = AttendanceLog::instance().absentees(Config::instance().classes().activeId(), QDate::currentDate());
+    m_rosterModel->setChecked(m_students->setOf(saved));
+    filterRoster(m_searchEdit->text());
+}
+
 void AttendanceSelectDialog::filterRoster(const QString& keyword) {
-    const QString k = keyword.trimmed();
-    for (int i = 0; i < m_roster->count(); ++i) {
-        auto* item = m_roster->item(i);
-        item->setHidden(!k.isEmpty() && !item->text().contains(k, Qt::CaseInsensitive));
-    }
+    m_rosterModel->setRows(m_searchIndex->filter(keyword.trimmed()));
 }
 
-void AttendanceSelectDialog::setSelectedAbsentees(const QStringList& absentees) {
-    for (int i = 0; i < m_roster->count(); ++i) {
-        auto* item = m_roster->item(i);
-        item->setCheckState(absentees.contains(item->text()) ? Qt::Checked : Qt::Unchecked);
-    }
+void AttendanceSelectDialog::setSelectedAbsentees(const StudentSet& absentees) {
+    m_rosterModel->setChecked(absentees);
+}
+
+StudentSet AttendanceSelectDialog::checkedStudents() const {
+    return m_rosterModel->checked();
 }
 
 void AttendanceSelectDialog::saveSelection() {
-    QStringList absentees;
-    for (int i = 0; i < m_roster->count(); ++i) {
-        if (m_roster->item(i)->checkState() == Qt::Checked) {
-            absentees.append(m_roster->item(i)->text());
-        }
+    const StudentSet absentees = checkedStudents();
+    if (!AttendanceLog::instance().append(Config::instance().classes().activeId(), QDate::currentDate(),
+                                          m_students->keys(absentees))) {
+        QMessageBox::warning(this, "保存失败", "考勤记录写入失败，今日结果仅保留在内存中。");
     }
     emit saved(absentees);
     hide();
 }
 
 void AttendanceSelectDialog::exportSelection() {
-    QStringList absentees;
-    for (int i = 0; i < m_roster->count(); ++i) {
-        if (m_roster->item(i)->checkState() == Qt::Checked) {
-            absentees.append(m_roster->item(i)->text());
-        }
+    if (!m_exportDialog) m_exportDialog = new AttendanceExportDialog(this);
+    m_exportDialog->openExport();
+}
+
+void AttendanceSelectDialog::closeEvent(QCloseEvent* event) {
+    smoothHide(this);
+    if (AppState::isQuitting()) { event->accept(); } else { event->ignore(); }
+}
+
+AttendanceExportDialog::AttendanceExportDialog(QWidget* parent) : QDialog(parent) {
+    const QString dialogTitle = "导出考勤记录";
+    decorateDialog(this, dialogTitle);
+    setFixedSize(460, 380);
+
+    auto* layout = new QVBoxLayout(this);
+    layout->addWidget(createDialogTitleBar(this, dialogTitle));
+    auto* tip = new QLabel("导出已保存的考勤记录，导出在后台进行，可随时取消。");
+    tip->setWordWrap(true);
+    layout->addWidget(tip);
+
+    auto* form = new QGridLayout;
+    form->setHorizontalSpacing(10);
+    form->setVerticalSpacing(8);
+    m_fromEdit = new QDateEdit;
+    m_toEdit = new QDateEdit;
+    for (auto* edit : {m_fromEdit, m_toEdit}) {
+        edit->setCalendarPopup(true);
+        edit->setDisplayFormat("yyyy-MM-dd");
     }
+    m_scopeCombo = new QComboBox;
+    m_scopeCombo->addItems({"当前班级", "全部班级"});
+    m_formatCombo = new QComboBox;
+    m_formatCombo->addItems({"CSV 表格 (*.csv)", "Excel 工作簿 (*.xlsx)"});
+    form->addWidget(new QLabel("开始日期"), 0, 0);
+    form->addWidget(m_fromEdit, 0, 1);
+    form->addWidget(new QLabel("结束日期"), 1, 0);
+    form->addWidget(m_toEdit, 1, 1);
+    form->addWidget(new QLabel("导出范围"), 2, 0);
+    form->addWidget(m_scopeCombo, 2, 1);
+    form->addWidget(new QLabel("文件格式"), 3, 0);
+    form->addWidget(m_formatCombo, 3, 1);
+    layout->addLayout(form);
 
-    const QString path = FluentTheme::getStyledSaveFileName(this, "导出缺勤名单",
-                                                      QString("考勤_%1.txt").arg(QDate::currentDate().toString("yyyyMMdd")),
-                                                      "Text File (*.txt)");
-    if (path.isEmpty()) {
-        return;
+    m_progress = new QProgressBar;
+    m_progress->setRange(0, 100);
+    m_progress->setValue(0);
+    m_statusLabel = new QLabel;
+    layout->addWidget(m_progress);
+    layout->addWidget(m_statusLabel);
+    layout->addStretch();
+
+    auto* buttons = new QHBoxLayout;
+    m_startButton = new QPushButton("开始导出");
+    m_cancelButton = new QPushButton("关闭");
+    m_startButton->setStyleSheet(buttonStylePrimary());
+    m_cancelButton->setStyleSheet(buttonStyleNeutral());
+    buttons->addStretch();
+    buttons->addWidget(m_startButton);
+    buttons->addWidget(m_cancelButton);
+    layout->addLayout(buttons);
+
+    m_exporter = new AttendanceExporter(this);
+    connect(m_startButton, &QPushButton::clicked, this, &AttendanceExportDialog::startExport);
+    connect(m_cancelButton, &QPushButton::clicked, [this]() {
+        if (m_exporter->isRunning()) m_exporter->cancel();
+        else smoothHide(this);
+    });
+    connect(m_exporter, &AttendanceExporter::progress, this, [this](int done, int total) {
+        m_progress->setValue(total > 0 ? int(qint64(done) * 100 / total) : 100);
+        m_statusLabel->setText(QString("正在导出 %1 / %2").arg(done).arg(total));
+    });
+    connect(m_exporter, &AttendanceExporter::finished, this, [this](bool ok, const QString& message) {
+        setRunning(false);
+        if (ok) m_progress->setValue(100);
+        m_statusLabel->setText(message);
+    });
+}
+
+void AttendanceExportDialog::openExport() {
+    if (!m_exporter->isRunning()) {
+        const QDate today = QDate::currentDate();
+        m_fromEdit->setDate(AttendanceMatrix::termStart(today));
+        m_toEdit->setDate(today);
+        m_progress->setValue(0);
+        m_statusLabel->clear();
     }
+    smoothShow(this);
+}
 
-    QFile out(path);
-    if (!out.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate)) {
-        QMessageBox::warning(this, "导出失败", "无法写入导出文件。");
-        return;
+void AttendanceExportDialog::startExport() {
+    AttendanceExportRequest request;
+    request.from = qMin(m_fromEdit->date(), m_toEdit->date());
+    request.to = qMax(m_fromEdit->date(), m_toEdit->date());
+    request.format = m_formatCombo->currentIndex() == 1 ? AttendanceExportRequest::Xlsx : AttendanceExportRequest::Csv;
+
+    const Config& config = Config::instance();
+    if (m_scopeCombo->currentIndex() == 1) {
+        request.classes.append({QString(), "默认班级"});
+        request.classes += config.classes().classes();
+    } else {
+        request.classes.append({config.classes().activeId(), config.activeClassName()});
     }
 
-    QTextStream stream(&out);
-    stream.setCodec("UTF-8");
-    stream << "日期：" << QDate::currentDate().toString("yyyy-MM-dd") << "\n";
-    stream << "缺勤人数：" << absentees.size() << "\n";
-    stream << "缺勤名单：" << (absentees.isEmpty() ? "无" : absentees.join("、")) << "\n";
-    QMessageBox::information(this, "导出成功", "缺勤名单已导出。");
+    const QString suffix = request.format == AttendanceExportRequest::Xlsx ? "xlsx" : "csv";
+    const QString name = QString("考勤_%1-%2.%3").arg(request.from.toString("yyyyMMdd"), request.to.toString("yyyyMMdd"), suffix);
+    request.path = FluentTheme::getStyledSaveFileName(this, "导出考勤记录", name, m_formatCombo->currentText());
+    if (request.path.isEmpty()) return;
+
+    if (m_exporter->start(request)) {
+        setRunning(true);
+        m_progress->setValue(0);
+        m_statusLabel->setText("正在准备导出...");
+    }
 }
 
-void AttendanceSelectDialog::closeEvent(QCloseEvent* event) {
+void AttendanceExportDialog::setRunning(bool running) {
+    m_startButton->setEnabled(!running);
+    m_cancelButton->setText(running ? "取消导出" : "关闭");
+    for (QWidget* w : std::initializer_list<QWidget*>{m_fromEdit, m_toEdit, m_scopeCombo, m_formatCombo}) {
+        w->setEnabled(!running);
+    }
+}
+
+void AttendanceExportDialog::closeEvent(QCloseEvent* event) {
+    // 导出在后台继续，窗口只是隐藏。
+    smoothHide(this);
+    if (AppState::isQuitting()) { event->accept(); } else { event->ignore(); }
+}
+
+AttendanceStatsDialog::AttendanceStatsDialog(QWidget* parent) : QDialog(parent) {
+    const QString dialogTitle = "本学期考勤统计";
+    decorateDialog(this, dialogTitle);
+    setFixedSize(820, 640);
+
+    auto* layout = new QVBoxLayout(this);
+    layout->addWidget(createDialogTitleBar(this, dialogTitle));
+    m_summaryLabel = new QLabel;
+    m_summaryLabel->setWordWrap(true);
+    m_summaryLabel->setStyleSheet("font-size:16px;font-weight:900;color:#23415f;background:#ffffff;border:1px solid #d3dfef;border-radius:12px;padding:10px 12px;");
+    m_weekdayLabel = new QLabel;
+    m_weekdayLabel->setWordWrap(true);
+    m_weekdayLabel->setStyleSheet("font-size:14px;font-weight:700;color:#304864;");
+    layout->addWidget(m_summaryLabel);
+    layout->addWidget(m_weekdayLabel);
+
+    m_table = new QTableWidget(0, 10);
+    m_table->setHorizontalHeaderLabels({"姓名", "缺勤天数", "出勤率(%)", "最长连续缺勤", "当前连续缺勤",
+                                        "周一", "周二", "周三", "周四", "周五"});
+    m_table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_table->verticalHeader()->setVisible(false);
+    m_table->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    m_table->setSortingEnabled(true);
+    m_table->setToolTip("双击某位学生查看本学期的缺勤日期");
+    connect(m_table, &QTableWidget::cellDoubleClicked, this, [this](int row) { showAbsences(row); });
+    layout->addWidget(m_table, 1);
+
+    auto* closeBtn = new QPushButton("关闭");
+    closeBtn->setStyleSheet(buttonStyleNeutral());
+    connect(closeBtn, &QPushButton::clicked, [this]() { smoothHide(this); });
+    layout->addWidget(closeBtn, 0, Qt::AlignRight);
+}
+
+void AttendanceStatsDialog::reloadIfStale() {
+    // 班级、名单或学期变化时才重新从考勤记录构建矩阵，其余情况沿用增量结果。
+    const QString classKey = Config::instance().classes().activeId();
+    const RosterPtr roster = Config::instance().snapshot()->roster;
+    const QDate today = QDate::currentDate();
+    const QDate from = AttendanceMatrix::termStart(today);
+    if (!m_loaded || m_matrix.classKey() != classKey || m_matrix.roster() != roster || m_matrix.from() != from
+        || m_matrix.to() < today) {
+        m_matrix.load(classKey, roster, from, from.addYears(1).addDays(-1));
+        m_loaded = true;
+    }
+    refreshTable();
+}
+
+void AttendanceStatsDialog::applyToday(const StudentSet& absentees) {
+    if (!m_loaded) return;
+    if (m_matrix.classKey() != Config::instance().classes().activeId()) {
+        m_loaded = false;
+        return;
+    }
+    m_matrix.setDay(QDate::currentDate(), absentees);
+    if (isVisible()) refreshTable();
+}
+
+void AttendanceStatsDialog::refreshTable() {
+    const RosterPtr roster = m_matrix.roster();
+    const QVector<StudentAttendance> rows = m_matrix.report();
+    const int days = m_matrix.dayCount();
+    const int students = roster->size();
+    const double classRate = days > 0 && students > 0 ? 100.0 * (1.0 - double(m_matrix.totalAbsences()) / (double(days) * students)) : 100.0;
+
+    m_summaryLabel->setText(QString("%1 至今  记录 %2 天  学生 %3 人  全班出勤率 %4%")
+                                .arg(m_matrix.from().toString("yyyy-MM-dd"))
+                                .arg(days)
+                                .arg(students)
+                                .arg(classRate, 0, 'f', 1));
+    static const char* const kWeekdays[] = {"周一", "周二", "周三", "周四", "周五", "周六", "周日"};
+    QStringList weekdayParts;
+    for (int weekday = 0; weekday < 7; ++weekday) {
+        const int recorded = m_matrix.weekdayDayCount(weekday);
+        if (recorded == 0 || students == 0) continue;
+        const double rate = 100.0 * m_matrix.weekdayAbsentCount(weekday) / (double(recorded) * students);
+        weekdayParts << QString("%1 %2%").arg(kWeekdays[weekday]).arg(rate, 0, 'f', 1);
+    }
+    m_weekdayLabel->setText(QString("按星期缺勤率：%1").arg(weekdayParts.isEmpty() ? "暂无记录" : weekdayParts.join("  ")));
+
+    m_table->setSortingEnabled(false);
+    m_table->setRowCount(rows.size());
+    for (int r = 0; r < rows.size(); ++r) {
+        const StudentAttendance& row = rows.at(r);
+        const auto setCell = [&](int column, const QVariant& value) {
+            auto* item = new QTableWidgetItem;
+            item->setData(Qt::DisplayRole, value);
+            item->setTextAlignment(Qt::AlignCenter);
+            m_table->setItem(r, column, item);
+        };
+        setCell(0, roster->name(row.id));
+        m_table->item(r, 0)->setData(Qt::UserRole, row.id);
+        setCell(1, row.absences);
+        setCell(2, qRound(m_matrix.attendanceRate(row.id) * 1000) / 10.0);
+        setCell(3, row.longestStreak);
+        setCell(4, row.currentStreak);
+        for (int weekday = 0; weekday < 5; ++weekday) setCell(5 + weekday, row.weekdayAbsences[weekday]);
+    }
+    m_table->setSortingEnabled(true);
+}
+
+void AttendanceStatsDialog::showAbsences(int row) {
+    const QTableWidgetItem* item = m_table->item(row, 0);
+    const RosterPtr roster = m_matrix.roster();
+    if (!item || !roster) return;
+    const StudentId id = item->data(Qt::UserRole).toInt();
+    if (id < 0 || id >= roster->size()) return;
+
+    // 直接查考勤记录的学生倒排表，不扫描整份记录。
+    StudentSet student = roster->emptySet();
+    student.insert(id);
+    const QVector<QDate> days = AttendanceLog::instance().absences(m_matrix.classKey(), roster->keys(student).value(0),
+                                                                   m_matrix.from(), QDate::currentDate());
+    static const char* const kWeekdays[] = {"周一", "周二", "周三", "周四", "周五", "周六", "周日"};
+    QStringList lines;
+    for (const QDate& day : days) lines << QString("%1 %2").arg(day.toString("yyyy-MM-dd"), kWeekdays[day.dayOfWeek() - 1]);
+    QMessageBox::information(this, QString("%1 的缺勤记录").arg(roster->name(id)),
+                             days.isEmpty() ? QString("本学期暂无缺勤记录。")
+                                            : QString("本学期缺勤 %1 天：\n%2").arg(days.size()).arg(lines.join("\n")));
+}
+
+void AttendanceStatsDialog::closeEvent(QCloseEvent* event) {
     smoothHide(this);
     if (AppState::isQuitting()) { event->accept(); } else { event->ignore(); }
 }
@@ -778,16 +1023,25 @@ RandomCallDialog::RandomCallDialog(QWidget* parent) : QDialog(parent) {
     title->setStyleSheet("font-size:22px;font-weight:800;");
     layout->addWidget(title, 0, Qt::AlignHCenter);
 
-    m_nameLabel = new QLabel("准备开始");
-    m_nameLabel->setAlignment(Qt::AlignCenter);
-    m_nameLabel->setMinimumHeight(120);
-    m_nameLabel->setStyleSheet("font-size:42px;font-weight:900;background:#ffffff;border:1px solid #d8e0eb;border-radius:18px;padding:8px;");
-    layout->addWidget(m_nameLabel);
+    m_nameView = new RollingNameView;
+    m_nameView->setMessage("准备开始");
+    layout->addWidget(m_nameView);
 
     m_hintLabel = new QLabel("点击“开始点名”后滚动，5秒后自动停止并锁定结果。");
     m_hintLabel->setWordWrap(true);
     layout->addWidget(m_hintLabel);
 
+    auto* countRow = new QHBoxLayout;
+    countRow->addWidget(new QLabel("每次抽取人数"));
+    m_pickCount = new QSpinBox;
+    m_pickCount->setRange(1, 10);
+    m_pickCount->setValue(1);
+    m_pickCount->setMinimumHeight(36);
+    countRow->addWidget(m_pickCount);
+    countRow->addStretch();
+    layout->addLayout(countRow);
+    m_picks.reserve(m_pickCount->maximum());
+
     m_historyLabel = new QLabel("最近点名：暂无");
     m_historyLabel->setWordWrap(true);
     m_historyLabel->setStyleSheet("background:#ffffff;border:1px solid #e0e7f0;border-radius:10px;padding:8px;");
@@ -796,25 +1050,47 @@ RandomCallDialog::RandomCallDialog(QWidget* parent) : QDialog(parent) {
     auto* row = new QHBoxLayout;
     m_toggleButton = new QPushButton("开始点名");
     m_copyButton = new QPushButton("复制结果");
+    m_awardButton = new QPushButton("回答加分");
     auto* aiCommentBtn = new QPushButton("AI点评该学生");
     m_closeButton = new QPushButton("隐藏窗口");
-    for (auto* btn : {m_toggleButton, m_copyButton, aiCommentBtn, m_closeButton}) {
+    for (auto* btn : {m_toggleButton, m_copyButton, m_awardButton, aiCommentBtn, m_closeButton}) {
         btn->setMinimumHeight(42);
         row->addWidget(btn, 1);
     }
     m_toggleButton->setStyleSheet(buttonStyleSuccess());
     m_copyButton->setStyleSheet(buttonStyleNeutral());
+    m_awardButton->setStyleSheet(buttonStyleWarning());
+    m_awardButton->setEnabled(false);
     aiCommentBtn->setStyleSheet(buttonStylePrimary());
     m_closeButton->setStyleSheet(buttonStyleNeutral());
     layout->addLayout(row);
 
     connect(m_toggleButton, &QPushButton::clicked, this, &RandomCallDialog::toggleRolling);
     connect(m_copyButton, &QPushButton::clicked, [this]() {
-        QGuiApplication::clipboard()->setText(m_nameLabel->text());
-        m_hintLabel->setText(QString("已复制：%1").arg(m_nameLabel->text()));
+        QGuiApplication::clipboard()->setText(m_nameView->text());
+        m_hintLabel->setText(QString("已复制：%1").arg(m_nameView->text()));
+    });
+    connect(m_awardButton, &QPushButton::clicked, [this]() {
+        const QString classKey = Config::instance().classes().activeId();
+        PointsLedger& ledger = PointsLedger::instance();
+        if (m_awardKeys.isEmpty()
+            || !ledger.award(classKey, PointsLedger::Kind::Student, m_awardKeys, 1, PointsLedger::Source::RandomCall)) {
+            return;
+        }
+        m_awardButton->setEnabled(false);
+        if (m_awardKeys.size() == 1) {
+            const QString& name = m_awardKeys.first();
+            m_hintLabel->setText(QString("已为 %1 加 1 分，累计 %2 分，排名第 %3")
+                                     .arg(name)
+                                     .arg(ledger.points(classKey, PointsLedger::Kind::Student, name))
+                                     .arg(ledger.rank(classKey, PointsLedger::Kind::Student, name)));
+        } else {
+            m_hintLabel->setText(QString("已为 %1 各加 1 分").arg(m_awardKeys.join("、")));
+        }
+        m_awardKeys.clear();
     });
     connect(aiCommentBtn, &QPushButton::clicked, [this]() {
-        const QString name = m_nameLabel->text().trimmed();
+        const QString name = m_nameView->text().trimmed();
         if (name.isEmpty() || name == "无名单" || name == "准备开始") {
             return;
         }
@@ -830,14 +1106,15 @@ RandomCallDialog::RandomCallDialog(QWidget* parent) : QDialog(parent) {
 
     m_timer = new QTimer(this);
     connect(m_timer, &QTimer::timeout, [this]() {
-        if (m_list.isEmpty()) {
+        if (!m_roster || m_roster->isEmpty()) {
             m_timer->stop();
             m_running = false;
-            m_nameLabel->setText("无名单");
+            m_nameView->setMessage("无名单");
             m_toggleButton->setText("开始点名（自动5秒）");
             return;
         }
-        m_nameLabel->setText(drawName());
+        // 每次换名只交给滚动视图一个新目标，中间帧只改位移。
+        if (m_engine.drawMany(m_pickCount->value(), &m_picks) > 0) m_nameView->rollTo(m_picks, m_timer->interval());
         ++m_count;
         if (m_count > 24) {
             m_timer->setInterval(110);
@@ -845,66 +1122,84 @@ RandomCallDialog::RandomCallDialog(QWidget* parent) : QDialog(parent) {
         if (m_count > 34) {
             m_timer->setInterval(180);
         }
-        if (m_rollStartAt.isValid() && m_rollStartAt.secsTo(QDateTime::currentDateTime()) >= 5) {
+        if (m_rollClock.isValid() && m_rollClock.elapsed() >= 5000) {
             toggleRolling();
         }
     });
 }
 
-QString RandomCallDialog::drawName() const {
-    const QStringList& basePool = (Config::instance().randomNoRepeat && !m_remainingList.isEmpty()) ? m_remainingList : m_list;
-    if (basePool.isEmpty()) {
-        return "无名单";
-    }
-
-    QStringList available;
-    const QDateTime now = QDateTime::currentDateTime();
-    for (const QString& name : basePool) {
-        const QDateTime last = m_recentPickedAt.value(name);
-        if (!last.isValid() || last.secsTo(now) >= 15 * 60) {
-            available.append(name);
-        }
-    }
-    const QStringList& pool = available.isEmpty() ? basePool : available;
-    return pool[QRandomGenerator::global()->bounded(pool.size())];
-}
-
 void RandomCallDialog::toggleRolling() {
     if (!m_running) {
-        if (m_list.isEmpty()) {
-            m_nameLabel->setText("无名单");
+        if (!m_roster || m_roster->isEmpty()) {
+            m_nameView->setMessage("无名单");
             return;
         }
         m_count = 0;
         m_running = true;
+        m_picks.clear();
+        m_awardKeys.clear();
+        m_awardButton->setEnabled(false);
         m_toggleButton->setText("点名中...");
         m_hintLabel->setText("点名进行中，5秒后自动停止...");
-        m_rollStartAt = QDateTime::currentDateTime();
+        m_engine.setNoRepeat(Config::instance().randomNoRepeat);
+        m_nameView->setSlotCount(m_pickCount->value());
+        m_nameView->resetFrameStats();
+        m_rollClock.start();
         m_timer->start(45);
         return;
     }
 
     m_timer->stop();
     m_running = false;
-    const QString selected = m_nameLabel->text().trimmed();
+    const RollingNameView::FrameStats stats = m_nameView->frameStats();
+    Logger::instance().info(QString("点名滚动帧时间：%1 帧，平均 %2 ms，最长 %3 ms，超过 25ms %4 帧")
+                                .arg(stats.frames)
+                                .arg(stats.averageMs, 0, 'f', 2)
+                                .arg(stats.worstMs, 0, 'f', 2)
+                                .arg(stats.slowFrames));
+
+    // 第一帧之前就停下时本轮还没有抽出任何人，不能确认或记录上一轮的结果。
+    if (m_picks.isEmpty()) {
+        m_toggleButton->setText("开始点名（自动5秒）");
+        m_hintLabel->setText("还没有抽出学生，请重新开始。");
+        return;
+    }
+    // 最后一次滚动可能还在进行，直接定格到确认的结果。
+    m_nameView->showPicks(m_picks);
+
+    const QStringList names = pickedNames();
+    QString selected = names.join("、");
     m_toggleButton->setText("再来一次（自动5秒）");
 
-    if (!selected.isEmpty() && selected != "无名单") {
-        m_recentPickedAt.insert(selected, QDateTime::currentDateTime());
-        m_history.prepend(selected);
+    bool roundFinished = false;
+    StudentSet picked = m_roster->emptySet();
+    for (const StudentId id : m_picks) {
+        roundFinished = m_engine.commit(id) || roundFinished;
+        picked.insert(id);
+    }
+    // 统计与积分按学生键记账，重名学生各记各的。
+    m_awardKeys = m_roster->keys(picked);
+    m_awardButton->setEnabled(!names.isEmpty());
+    if (!names.isEmpty()) {
+        const QString classKey = Config::instance().classes().activeId();
+        CallStats& callStats = CallStats::instance();
+        callStats.record(classKey, m_awardKeys);
+        if (m_awardKeys.size() == 1) {
+            selected += QString("（累计被点 %1 次）").arg(callStats.count(classKey, m_awardKeys.first()));
+        }
+        refreshWeights();
+        for (const QString& name : names) m_history.prepend(name);
         while (m_history.size() > Config::instance().randomHistorySize) {
             m_history.removeLast();
         }
         m_historyLabel->setText(QString("最近点名：%1").arg(m_history.join("、")));
     }
 
-    if (Config::instance().randomNoRepeat && !selected.isEmpty() && selected != "无名单") {
-        m_remainingList.removeAll(selected);
-        if (m_remainingList.isEmpty()) {
-            m_remainingList = m_list;
+    if (m_engine.noRepeat() && !names.isEmpty()) {
+        if (roundFinished) {
             m_hintLabel->setText("本轮已点完全部学生，已自动重置名单。");
         } else {
-            m_hintLabel->setText(QString("已确定：%1（剩余 %2 人）").arg(selected).arg(m_remainingList.size()));
+            m_hintLabel->setText(QString("已确定：%1（剩余 %2 人）").arg(selected).arg(m_engine.remaining()));
         }
     } else {
         m_hintLabel->setText(QString("已确定：%1").arg(selected));
@@ -912,22 +1207,51 @@ void RandomCallDialog::toggleRolling() {
 }
 
 void RandomCallDialog::startAnim() {
-    m_list = Config::instance().getStudentList();
-    m_remainingList = m_list;
+    // 名单未变化时沿用同一实例，冷却状态保留在抽取结构里，只重新开始一轮。
+    const RosterPtr roster = Config::instance().snapshot()->roster;
+    m_engine.setNoRepeat(Config::instance().randomNoRepeat);
+    if (roster != m_roster) {
+        m_roster = roster;
+        m_engine.reset(m_roster->size());
+        m_nameView->setRoster(m_roster);
+    } else {
+        m_engine.restartRound();
+    }
+    CallStats::instance().ensureLoaded();
+    refreshWeights();
+    m_picks.clear();
+    m_awardKeys.clear();
+    m_awardButton->setEnabled(false);
     m_running = false;
     m_timer->stop();
     m_toggleButton->setText("开始点名（自动5秒）");
     m_historyLabel->setText(m_history.isEmpty() ? "最近点名：暂无" : QString("最近点名：%1").arg(m_history.join("、")));
-    if (m_list.isEmpty()) {
-        m_nameLabel->setText("无名单");
+    if (m_roster->isEmpty()) {
+        m_nameView->setMessage("无名单");
         m_hintLabel->setText("请先在设置中导入名单");
     } else {
-        m_nameLabel->setText("准备开始");
-        m_hintLabel->setText(Config::instance().randomNoRepeat ? "当前模式：无重复点名（每轮自动重置）" : "当前模式：允许重复点名");
+        m_nameView->setMessage("准备开始");
+        QString mode = Config::instance().randomNoRepeat ? "当前模式：无重复点名（每轮自动重置）" : "当前模式：允许重复点名";
+        if (Config::instance().randomFairWeighted) mode += "，按历史次数公平加权";
+        m_hintLabel->setText(mode);
     }
     smoothShow(this);
 }
 
+QStringList RandomCallDialog::pickedNames() const {
+    QStringList names;
+    for (const StudentId id : m_picks) names.append(m_roster->name(id));
+    return names;
+}
+
+void RandomCallDialog::refreshWeights() {
+    if (Config::instance().randomFairWeighted) {
+        m_engine.setWeights(CallStats::instance().weights(Config::instance().classes().activeId(), *m_roster));
+    } else {
+        m_engine.setWeights({});
+    }
+}
+
 void RandomCallDialog::closeEvent(QCloseEvent* event) {
     smoothHide(this);
     if (AppState::isQuitting()) { event->accept(); } else { event->ignore(); }
@@ -964,38 +1288,27 @@ ClassTimerDialog::ClassTimerDialog(QWidget* parent) : QDialog(parent) {
     }
     layout->addLayout(btnRow);
 
-    m_timer = new QTimer(this);
-    connect(m_timer, &QTimer::timeout, [this]() {
-        if (m_remainingSeconds > 0) {
-            --m_remainingSeconds;
-            updateCountdownText();
-            if (m_remainingSeconds == 0) {
-                m_timer->stop();
-                m_running = false;
-                m_startPauseButton->setText("开始");
-                QApplication::beep();
-            }
-        }
-    });
-
     connect(m_startPauseButton, &QPushButton::clicked, [this]() {
         if (!m_running) {
-            if (m_remainingSeconds <= 0) {
-                m_remainingSeconds = m_minutesSpin->value() * 60;
+            if (m_remainingMs <= 0) {
+                m_remainingMs = m_minutesSpin->value() * 60 * 1000;
             }
             m_running = true;
-            m_timer->start(1000);
+            m_runFromMs = m_remainingMs;
+            m_runClock.start();
+            tick();
             m_startPauseButton->setText("暂停");
             return;
         }
         m_running = false;
-        m_timer->stop();
+        stopTicking();
+        m_remainingMs = qMax<qint64>(0, m_runFromMs - m_runClock.elapsed());
         m_startPauseButton->setText("继续");
     });
     connect(m_resetButton, &QPushButton::clicked, [this]() {
-        m_timer->stop();
+        stopTicking();
         m_running = false;
-        m_remainingSeconds = m_minutesSpin->value() * 60;
+        m_remainingMs = m_minutesSpin->value() * 60 * 1000;
         m_startPauseButton->setText("开始");
         updateCountdownText();
     });
@@ -1012,13 +1325,33 @@ ClassTimerDialog::ClassTimerDialog(QWidget* parent) : QDialog(parent) {
     });
     connect(closeButton, &QPushButton::clicked, [this]() { smoothHide(this); });
 
-    m_remainingSeconds = m_minutesSpin->value() * 60;
+    m_remainingMs = m_minutesSpin->value() * 60 * 1000;
     updateCountdownText();
 }
 
+// 剩余时间按开始时刻推算，不靠逐秒递减；只在显示的秒数即将变化时唤醒。
+void ClassTimerDialog::tick() {
+    m_tickTimer = 0;
+    m_remainingMs = qMax<qint64>(0, m_runFromMs - m_runClock.elapsed());
+    updateCountdownText();
+    if (m_remainingMs == 0) {
+        m_running = false;
+        m_startPauseButton->setText("开始");
+        QApplication::beep();
+        return;
+    }
+    m_tickTimer = TimerWheel::instance().schedule((m_remainingMs - 1) % 1000 + 1, this, [this]() { tick(); }, 20);
+}
+
+void ClassTimerDialog::stopTicking() {
+    TimerWheel::instance().cancel(m_tickTimer);
+    m_tickTimer = 0;
+}
+
 void ClassTimerDialog::updateCountdownText() {
-    const int mm = m_remainingSeconds / 60;
-    const int ss = m_remainingSeconds % 60;
+    const int seconds = int((m_remainingMs + 999) / 1000);
+    const int mm = seconds / 60;
+    const int ss = seconds % 60;
     m_countdownLabel->setText(QString("%1:%2").arg(mm, 2, 10, QChar('0')).arg(ss, 2, 10, QChar('0')));
 }
 
@@ -1116,7 +1449,7 @@ void ClassNoteDialog::closeEvent(QCloseEvent* event) {
 GroupSplitDialog::GroupSplitDialog(QWidget* parent) : QDialog(parent) {
     const QString dialogTitle = "分组抽签";
     decorateDialog(this, dialogTitle);
-    setFixedSize(540, 430);
+    setFixedSize(540, 470);
 
     auto* layout = new QVBoxLayout(this);
     layout->addWidget(createDialogTitleBar(this, dialogTitle));
@@ -1140,7 +1473,33 @@ GroupSplitDialog::GroupSplitDialog(QWidget* parent) : QDialog(parent) {
     m_result->setReadOnly(true);
     layout->addWidget(m_result, 1);
 
+    m_summary = new QLabel;
+    m_summary->setWordWrap(true);
+    layout->addWidget(m_summary);
+
+    auto* ruleRow = new QHBoxLayout;
+    auto* apartBtn = new QPushButton("不同组规则");
+    auto* togetherBtn = new QPushButton("同组规则");
+    auto* awardBtn = new QPushButton("小组加分");
+    m_confirmBtn = new QPushButton("确认分组");
+    apartBtn->setStyleSheet(buttonStyleNeutral());
+    togetherBtn->setStyleSheet(buttonStyleNeutral());
+    awardBtn->setStyleSheet(buttonStyleWarning());
+    m_confirmBtn->setStyleSheet(buttonStyleSuccess());
+    m_confirmBtn->setToolTip("记录本次分组，之后的分组会尽量避开已同组过的搭档");
+    m_confirmBtn->setEnabled(false);
+    ruleRow->addWidget(apartBtn);
+    ruleRow->addWidget(togetherBtn);
+    ruleRow->addStretch();
+    ruleRow->addWidget(awardBtn);
+    ruleRow->addWidget(m_confirmBtn);
+    layout->addLayout(ruleRow);
+
     connect(generateBtn, &QPushButton::clicked, this, &GroupSplitDialog::generate);
+    connect(m_confirmBtn, &QPushButton::clicked, this, &GroupSplitDialog::confirmGroups);
+    connect(awardBtn, &QPushButton::clicked, this, &GroupSplitDialog::awardGroup);
+    connect(apartBtn, &QPushButton::clicked, [this]() { editRules(false); });
+    connect(togetherBtn, &QPushButton::clicked, [this]() { editRules(true); });
     connect(aiTaskBtn, &QPushButton::clicked, [this]() {
         const QString groups = m_result->toPlainText().trimmed();
         if (groups.isEmpty()) {
@@ -1157,25 +1516,124 @@ GroupSplitDialog::GroupSplitDialog(QWidget* parent) : QDialog(parent) {
     connect(closeBtn, &QPushButton::clicked, [this]() { smoothHide(this); });
 }
 
+GroupSplitDialog::~GroupSplitDialog() {
+    if (m_worker) {
+        m_worker->wait();
+        delete m_worker;
+    }
+}
+
 void GroupSplitDialog::generate() {
-    QStringList list = Config::instance().getStudentList();
-    if (list.isEmpty()) {
+    if (m_worker) {
+        m_rerun = true;
+        return;
+    }
+    const Config& cfg = Config::instance();
+    const RosterPtr roster = cfg.snapshot()->roster;
+    if (roster->isEmpty()) {
         m_result->setPlainText("暂无学生名单，请先导入。");
+        m_summary->clear();
+        m_confirmBtn->setEnabled(false);
         return;
     }
 
-    for (int i = list.size() - 1; i > 0; --i) {
-        const int j = QRandomGenerator::global()->bounded(i + 1);
-        list.swapItemsAt(i, j);
+    m_roster = roster;
+    m_classKey = cfg.classes().activeId();
+    m_problem = GroupProblem::fromRoster(*roster, m_groupSize->value(), cfg.groupKeepApart, cfg.groupKeepTogether);
+    m_problem.seed = Rng::session().next();
+    m_result->setPlainText("正在优化分组...");
+    m_summary->clear();
+    m_confirmBtn->setEnabled(false);
+
+    m_worker = QThread::create([this]() {
+        m_problem.history = PairHistory::load(m_classKey, *m_roster);
+        m_plan = GroupOptimizer::solve(m_problem);
+    });
+    m_worker->setObjectName("GroupOptimizer");
+    connect(m_worker, &QThread::finished, this, &GroupSplitDialog::finishGenerate);
+    m_worker->start(QThread::LowPriority);
+}
+
+void GroupSplitDialog::finishGenerate() {
+    m_worker->deleteLater();
+    m_worker = nullptr;
+    if (m_rerun) {
+        m_rerun = false;
+        generate();
+        return;
     }
 
-    const int each = qMax(2, m_groupSize->value());
     QString out;
-    int groupIndex = 1;
-    for (int i = 0; i < list.size(); i += each) {
-        out += QString("第%1组：%2\n").arg(groupIndex++).arg(list.mid(i, each).join("、"));
+    for (int g = 0; g < m_plan.groups.size(); ++g) {
+        QStringList members;
+        for (const StudentId id : m_plan.groups.at(g)) members.append(m_roster->name(id));
+        out += QString("第%1组：%2\n").arg(g + 1).arg(members.join("、"));
     }
     m_result->setPlainText(out.trimmed());
+
+    QString summary = m_plan.repeatPairs == 0 ? QString("没有重复搭档")
+                                              : QString("重复搭档 %1 对").arg(m_plan.repeatPairs);
+    if (m_plan.violations > 0) summary += QString("，%1 条规则无法同时满足").arg(m_plan.violations);
+    m_summary->setText(summary);
+    m_confirmBtn->setEnabled(true);
+    Logger::instance().info(QString("分组优化：%1 人，迭代 %2 次，用时 %3ms，重复搭档 %4 对，违反规则 %5 条")
+                                .arg(m_roster->size())
+                                .arg(m_plan.iterations)
+                                .arg(m_plan.elapsedMs, 0, 'f', 1)
+                                .arg(m_plan.repeatPairs)
+                                .arg(m_plan.violations));
+}
+
+void GroupSplitDialog::confirmGroups() {
+    if (m_worker || m_plan.groups.isEmpty()) return;
+    m_problem.history.record(m_plan.groups);
+    if (!m_problem.history.save(m_classKey, *m_roster)) {
+        m_summary->setText("分组历史保存失败，请查看日志");
+        return;
+    }
+    m_confirmBtn->setEnabled(false);
+    m_summary->setText(m_summary->text() + "；已记录本次分组");
+}
+
+void GroupSplitDialog::awardGroup() {
+    if (m_worker || m_plan.groups.isEmpty()) return;
+    QStringList items;
+    for (int g = 0; g < m_plan.groups.size(); ++g) {
+        QStringList members;
+        for (const StudentId id : m_plan.groups.at(g)) members.append(m_roster->name(id));
+        items.append(QString("第%1组：%2").arg(g + 1).arg(members.join("、")));
+    }
+    bool ok = false;
+    const QString item = QInputDialog::getItem(this, "小组加分", "为哪一组的每位成员加 1 分：", items, 0, false, &ok);
+    const int g = items.indexOf(item);
+    if (!ok || g < 0) return;
+
+    StudentSet members = m_roster->emptySet();
+    for (const StudentId id : m_plan.groups.at(g)) members.insert(id);
+    if (PointsLedger::instance().award(m_classKey, PointsLedger::Kind::Student, m_roster->keys(members), 1,
+                                       PointsLedger::Source::Group)) {
+        m_summary->setText(QString("第%1组每位成员已加 1 分").arg(g + 1));
+    }
+}
+
+void GroupSplitDialog::editRules(bool together) {
+    Config& cfg = Config::instance();
+    QStringList& rules = together ? cfg.groupKeepTogether : cfg.groupKeepApart;
+    const QString label = together ? "每行一条规则，列出需要同组的学生（姓名用顿号、逗号或空格分隔）："
+                                   : "每行一条规则，列出不宜同组的学生（姓名用顿号、逗号或空格分隔）：";
+    bool ok = false;
+    const QString text = QInputDialog::getMultiLineText(this, together ? "同组规则" : "不同组规则", label,
+                                                        rules.join("\n"), &ok);
+    if (!ok) return;
+
+    QStringList updated;
+    for (const QString& line : text.split('\n')) {
+        if (!line.trimmed().isEmpty()) updated.append(line.trimmed());
+    }
+    if (updated == rules) return;
+    rules = updated;
+    cfg.commit(ConfigChange::Behavior);
+    generate();
 }
 
 void GroupSplitDialog::openSplitter() {
@@ -1192,7 +1650,7 @@ void GroupSplitDialog::closeEvent(QCloseEvent* event) {
 ScoreBoardDialog::ScoreBoardDialog(QWidget* parent) : QDialog(parent) {
     const QString dialogTitle = "课堂计分板";
     decorateDialog(this, dialogTitle);
-    setFixedSize(460, 320);
+    setFixedSize(460, 560);
 
     auto* layout = new QVBoxLayout(this);
     layout->addWidget(createDialogTitleBar(this, dialogTitle));
@@ -1205,6 +1663,17 @@ ScoreBoardDialog::ScoreBoardDialog(QWidget* parent) : QDialog(parent) {
     layout->addWidget(m_teamBLabel);
     layout->addWidget(m_scoreLabel);
 
+    auto* boardRow = new QHBoxLayout;
+    boardRow->addWidget(new QLabel("学生积分榜"));
+    boardRow->addStretch();
+    m_boardRange = new QComboBox;
+    m_boardRange->addItems({"本周", "累计"});
+    boardRow->addWidget(m_boardRange);
+    layout->addLayout(boardRow);
+    m_leaderboard = new QListWidget;
+    m_leaderboard->setSelectionMode(QAbstractItemView::NoSelection);
+    layout->addWidget(m_leaderboard, 1);
+
     auto* row = new QHBoxLayout;
     auto* aMinus = new QPushButton("A -1");
     auto* aPlus = new QPushButton("A +1");
@@ -1219,10 +1688,11 @@ ScoreBoardDialog::ScoreBoardDialog(QWidget* parent) : QDialog(parent) {
     }
     layout->addLayout(row);
 
-    connect(aMinus, &QPushButton::clicked, [this]() { m_scoreA = qMax(0, m_scoreA - 1); refreshScore(); });
-    connect(aPlus, &QPushButton::clicked, [this]() { ++m_scoreA; refreshScore(); });
-    connect(bMinus, &QPushButton::clicked, [this]() { m_scoreB = qMax(0, m_scoreB - 1); refreshScore(); });
-    connect(bPlus, &QPushButton::clicked, [this]() { ++m_scoreB; refreshScore(); });
+    connect(aMinus, &QPushButton::clicked, [this]() { awardTeam(true, -1); });
+    connect(aPlus, &QPushButton::clicked, [this]() { awardTeam(true, 1); });
+    connect(bMinus, &QPushButton::clicked, [this]() { awardTeam(false, -1); });
+    connect(bPlus, &QPushButton::clicked, [this]() { awardTeam(false, 1); });
+    connect(m_boardRange, QOverload<int>::of(&QComboBox::currentIndexChanged), [this]() { refreshLeaderboard(); });
     connect(resetBtn, &QPushButton::clicked, [this]() { m_scoreA = 0; m_scoreB = 0; refreshScore(); });
     connect(aiCommentBtn, &QPushButton::clicked, [this]() {
         const QString prompt = QString("当前比分：%1 %2 : %3 %4，请给出一句鼓励点评和下一轮建议")
@@ -1241,14 +1711,45 @@ ScoreBoardDialog::ScoreBoardDialog(QWidget* parent) : QDialog(parent) {
     connect(closeBtn, &QPushButton::clicked, [this]() { smoothHide(this); });
 }
 
+// 本场比分只在窗口内计数，每次加减同时记入积分账本，队伍的本周累计跨场次保留。
+void ScoreBoardDialog::awardTeam(bool teamA, int delta) {
+    int& score = teamA ? m_scoreA : m_scoreB;
+    if (score + delta < 0) return;
+    score += delta;
+    const Config& cfg = Config::instance();
+    PointsLedger::instance().award(cfg.classes().activeId(), PointsLedger::Kind::Team,
+                                   {teamA ? cfg.scoreTeamAName : cfg.scoreTeamBName}, delta,
+                                   PointsLedger::Source::ScoreBoard);
+    refreshScore();
+}
+
 void ScoreBoardDialog::refreshScore() {
-    m_teamALabel->setText(QString("%1").arg(Config::instance().scoreTeamAName));
-    m_teamBLabel->setText(QString("%1").arg(Config::instance().scoreTeamBName));
+    const Config& cfg = Config::instance();
+    const QString classKey = cfg.classes().activeId();
+    const PointsLedger& ledger = PointsLedger::instance();
+    m_teamALabel->setText(QString("%1 · 本周累计 %2 分")
+                              .arg(cfg.scoreTeamAName)
+                              .arg(ledger.weekPoints(classKey, PointsLedger::Kind::Team, cfg.scoreTeamAName)));
+    m_teamBLabel->setText(QString("%1 · 本周累计 %2 分")
+                              .arg(cfg.scoreTeamBName)
+                              .arg(ledger.weekPoints(classKey, PointsLedger::Kind::Team, cfg.scoreTeamBName)));
     m_scoreLabel->setText(QString("%1 : %2").arg(m_scoreA).arg(m_scoreB));
 }
 
+void ScoreBoardDialog::refreshLeaderboard() {
+    const bool thisWeek = m_boardRange->currentIndex() == 0;
+    const QVector<PointsLedger::Standing> standings = PointsLedger::instance().top(
+        Config::instance().classes().activeId(), PointsLedger::Kind::Student, 10, thisWeek);
+    m_leaderboard->clear();
+    for (const PointsLedger::Standing& s : standings) {
+        m_leaderboard->addItem(QString("第%1名  %2  %3 分").arg(s.rank).arg(s.name).arg(s.points));
+    }
+    if (standings.isEmpty()) m_leaderboard->addItem("暂无积分记录，点名或分组后可为学生加分");
+}
+
 void ScoreBoardDialog::openBoard() {
     refreshScore();
+    refreshLeaderboard();
     smoothShow(this);
 }
 
@@ -1771,6 +2272,8 @@ QWidget* SettingsDialog::createPageClassTools() {
     auto* randomLayout = new QVBoxLayout(groupRandom);
     m_randomNoRepeat = new QCheckBox("随机点名无重复（点完一轮自动重置）");
     randomLayout->addWidget(m_randomNoRepeat);
+    m_randomFairWeighted = new QCheckBox("公平加权（被点次数越多、越近期被点，概率越低）");
+    randomLayout->addWidget(m_randomFairWeighted);
 
     auto* historyRow = new QHBoxLayout;
     historyRow->addWidget(new QLabel("历史记录条数（三级）"));
@@ -1820,7 +2323,10 @@ QWidget* SettingsDialog::createPageClassTools() {
 
     auto* groupSelfStudy = new QGroupBox("自习课设置（二级）");
     auto* selfStudyLayout = new QVBoxLayout(groupSelfStudy);
-    selfStudyLayout->addWidget(new QLabel("自习时段（HH:mm-HH:mm，可添加多节）"));
+    auto* periodHint = new QLabel("自习时段，可添加多节：每天写 19:00-19:45；指定星期写 周一至周五 19:00-19:45；"
+                                  "调课写 2026-10-10 19:30-20:15；放假写 2026-10-01~2026-10-07 休");
+    periodHint->setWordWrap(true);
+    selfStudyLayout->addWidget(periodHint);
     m_selfStudyPeriodList = new QListWidget;
     m_selfStudyPeriodList->setMinimumHeight(110);
     selfStudyLayout->addWidget(m_selfStudyPeriodList);
@@ -1833,21 +2339,22 @@ QWidget* SettingsDialog::createPageClassTools() {
     selfOps->addStretch();
     selfStudyLayout->addLayout(selfOps);
     connect(addPeriodBtn, &QPushButton::clicked, this, [this]() {
-        const QString txt = QInputDialog::getText(this, "添加自习时段", "格式：HH:mm-HH:mm", QLineEdit::Normal, "19:00-19:45");
-        if (txt.trimmed().isEmpty()) return;
-        const QStringList parts = txt.split('-', Qt::SkipEmptyParts);
-        if (parts.size() != 2 || !QTime::fromString(parts[0].trimmed(), "HH:mm").isValid() || !QTime::fromString(parts[1].trimmed(), "HH:mm").isValid()) {
-            QMessageBox::warning(this, "格式错误", "请输入有效时间段，例如 19:00-19:45");
+        const QString txt = QInputDialog::getText(this, "添加自习时段", "格式：[星期或日期] HH:mm-HH:mm，或 日期 休",
+                                                  QLineEdit::Normal, "19:00-19:45").simplified();
+        if (txt.isEmpty()) return;
+        QString error;
+        if (!Timetable::parseRule(txt, &error)) {
+            QMessageBox::warning(this, "格式错误", QString("%1\n例如 19:00-19:45 或 周一至周五 19:00-19:45").arg(error));
             return;
         }
-        m_selfStudyPeriodList->addItem(parts[0].trimmed() + "-" + parts[1].trimmed());
+        m_selfStudyPeriodList->addItem(txt);
     });
     connect(removePeriodBtn, &QPushButton::clicked, this, [this]() {
         delete m_selfStudyPeriodList->takeItem(m_selfStudyPeriodList->currentRow());
     });
 
     auto* idleRow = new QHBoxLayout;
-    idleRow->addWidget(new QLabel("自习息屏触发预留阈值（秒，当前按时段自动触发）"));
+    idleRow->addWidget(new QLabel("自习时段内无操作多久后重新息屏（秒）"));
     m_selfStudyIdleSeconds = new QSpinBox;
     m_selfStudyIdleSeconds->setRange(60, 900);
     m_selfStudyIdleSeconds->setSingleStep(30);
@@ -1870,7 +2377,7 @@ QWidget* SettingsDialog::createPageDataManagement() {
 
     auto* importGroup = new QGroupBox("名单与导入");
     auto* importLayout = new QVBoxLayout(importGroup);
-    auto* importBtn = new QPushButton("导入班级名单（CSV/TXT）");
+    auto* importBtn = new QPushButton("导入班级名单（Excel/CSV/TXT）");
     importBtn->setStyleSheet(buttonStylePrimary());
     connect(importBtn, &QPushButton::clicked, this, &SettingsDialog::importStudents);
     importLayout->addWidget(importBtn);
@@ -2095,6 +2602,7 @@ void SettingsDialog::loadData() {
     m_sidebarWidth->setValue(cfg.radialMenuRadius);
     m_animationDuration->setValue(cfg.menuAutoCollapseSeconds);
     m_randomNoRepeat->setChecked(cfg.randomNoRepeat);
+    m_randomFairWeighted->setChecked(cfg.randomFairWeighted);
     m_historyCount->setValue(cfg.randomHistorySize);
     m_allowExternalLinks->setChecked(cfg.allowExternalLinks);
     m_groupSize->setValue(cfg.groupSplitSize);
@@ -2215,31 +2723,38 @@ void SettingsDialog::moveDown() {
 
 void SettingsDialog::saveData() {
     auto& cfg = Config::instance();
-    cfg.floatingOpacity = m_floatingOpacity->value();
-    cfg.attendanceSummaryWidth = m_summaryWidth->value();
-    cfg.startCollapsed = m_startCollapsed->isChecked();
-    cfg.trayClickToOpen = m_trayClickToOpen->isChecked();
-    cfg.showAttendanceSummaryOnStart = m_showAttendanceSummaryOnStart->isChecked();
-    cfg.collapseHidesToolWindows = m_collapseHidesToolWindows->isChecked();
-    cfg.floatingBallSize = m_ballSize->value();
-    cfg.iconSize = m_buttonIconSize->value();
-    cfg.radialMenuRadius = m_sidebarWidth->value();
-    cfg.menuAutoCollapseSeconds = m_animationDuration->value();
-    cfg.randomNoRepeat = m_randomNoRepeat->isChecked();
-    cfg.randomHistorySize = m_historyCount->value();
-    cfg.allowExternalLinks = m_allowExternalLinks->isChecked();
-    cfg.groupSplitSize = m_groupSize->value();
-    cfg.scoreTeamAName = m_scoreTeamAName->text().trimmed().isEmpty() ? QString("红队") : m_scoreTeamAName->text().trimmed();
-    cfg.scoreTeamBName = m_scoreTeamBName->text().trimmed().isEmpty() ? QString("蓝队") : m_scoreTeamBName->text().trimmed();
-    cfg.seewoPath = m_seewoPathEdit->text().trimmed();
-    cfg.siliconFlowApiKey = m_apiKeyEdit->text().trimmed();
-    cfg.siliconFlowModel = m_aiModelEdit->text().trimmed().isEmpty() ? QString("Qwen/Qwen3-8B") : m_aiModelEdit->text().trimmed();
-    cfg.siliconFlowEndpoint = m_aiEndpointEdit->text().trimmed().isEmpty() ? QString("https://api.siliconflow.cn/v1/chat/completions")
-                                                                            : m_aiEndpointEdit->text().trimmed();
-    cfg.selfStudyPeriods.clear();
-    for (int i = 0; i < m_selfStudyPeriodList->count(); ++i) cfg.selfStudyPeriods.append(m_selfStudyPeriodList->item(i)->text());
-    cfg.selfStudyIdleSeconds = m_selfStudyIdleSeconds->value();
-    cfg.screenOffShowQuote = m_screenOffShowQuote->isChecked();
+    ConfigChange::Flags changes;
+    assignTracked(cfg.floatingOpacity, m_floatingOpacity->value(), ConfigChange::BallOpacity, changes);
+    assignTracked(cfg.attendanceSummaryWidth, m_summaryWidth->value(), ConfigChange::AttendanceSummary, changes);
+    assignTracked(cfg.startCollapsed, m_startCollapsed->isChecked(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.trayClickToOpen, m_trayClickToOpen->isChecked(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.showAttendanceSummaryOnStart, m_showAttendanceSummaryOnStart->isChecked(), ConfigChange::AttendanceSummary, changes);
+    assignTracked(cfg.collapseHidesToolWindows, m_collapseHidesToolWindows->isChecked(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.floatingBallSize, m_ballSize->value(), ConfigChange::BallSize, changes);
+    assignTracked(cfg.iconSize, m_buttonIconSize->value(), ConfigChange::IconSize, changes);
+    assignTracked(cfg.radialMenuRadius, m_sidebarWidth->value(), ConfigChange::RadialLayout, changes);
+    assignTracked(cfg.menuAutoCollapseSeconds, m_animationDuration->value(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.randomNoRepeat, m_randomNoRepeat->isChecked(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.randomFairWeighted, m_randomFairWeighted->isChecked(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.randomHistorySize, m_historyCount->value(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.allowExternalLinks, m_allowExternalLinks->isChecked(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.groupSplitSize, m_groupSize->value(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.scoreTeamAName, m_scoreTeamAName->text().trimmed().isEmpty() ? QString("红队") : m_scoreTeamAName->text().trimmed(),
+                  ConfigChange::Behavior, changes);
+    assignTracked(cfg.scoreTeamBName, m_scoreTeamBName->text().trimmed().isEmpty() ? QString("蓝队") : m_scoreTeamBName->text().trimmed(),
+                  ConfigChange::Behavior, changes);
+    assignTracked(cfg.seewoPath, m_seewoPathEdit->text().trimmed(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.siliconFlowApiKey, m_apiKeyEdit->text().trimmed(), ConfigChange::Behavior, changes);
+    assignTracked(cfg.siliconFlowModel, m_aiModelEdit->text().trimmed().isEmpty() ? QString("Qwen/Qwen3-8B") : m_aiModelEdit->text().trimmed(),
+                  ConfigChange::Behavior, changes);
+    assignTracked(cfg.siliconFlowEndpoint, m_aiEndpointEdit->text().trimmed().isEmpty() ? QString("https://api.siliconflow.cn/v1/chat/completions")
+                                                                                        : m_aiEndpointEdit->text().trimmed(),
+                  ConfigChange::Behavior, changes);
+    QStringList periods;
+    for (int i = 0; i < m_selfStudyPeriodList->count(); ++i) periods.append(m_selfStudyPeriodList->item(i)->text());
+    assignTracked(cfg.selfStudyPeriods, periods, ConfigChange::SelfStudy, changes);
+    assignTracked(cfg.selfStudyIdleSeconds, m_selfStudyIdleSeconds->value(), ConfigChange::SelfStudy, changes);
+    assignTracked(cfg.screenOffShowQuote, m_screenOffShowQuote->isChecked(), ConfigChange::SelfStudy, changes);
 
     QVector<AppButton> buttons;
     for (int i = 0; i < m_buttonList->count(); ++i) {
@@ -2250,11 +2765,12 @@ void SettingsDialog::saveData() {
                         item->data(Qt::UserRole + 3).toString(),
                         item->data(Qt::UserRole + 4).toBool()});
     }
+    if (cfg.setButtons(buttons)) {
+        changes |= ConfigChange::Buttons;
+    }
 
-    cfg.setButtons(buttons);
-    cfg.save();
-    Logger::instance().info("设置已保存");
-    emit configChanged();
+    cfg.commit(changes);
+    Logger::instance().info(QString("设置已保存（变更标记 0x%1）").arg(static_cast<quint32>(changes), 0, 16));
     smoothHide(this);
 }
 
@@ -2265,7 +2781,6 @@ void SettingsDialog::restoreDefaults() {
 
     Config::instance().resetToDefaults(true);
     loadData();
-    emit configChanged();
 }
 
 void SettingsDialog::closeEvent(QCloseEvent* event) {
@@ -3,14 +3,17 @@
 #include <QCheckBox>
 #include <QCloseEvent>
 #include <QComboBox>
+#include <QDateEdit>
 #include <QDialog>
 #include <QDateTime>
+#include <QElapsedTimer>
 #include <QGroupBox>
 #include <QHash>
 #include <QJsonArray>
 #include <QLabel>
 #include <QLineEdit>
 #include <QProgressBar>
+#include <QListView>
 #include <QListWidget>
 #include <QPushButton>
 #include <QSlider>
@@ -19,25 +22,36 @@
 #include <QToolButton>
 #include <QTableWidget>
 #include <QTextEdit>
+#include <QThread>
 #include <QTimer>
 #include <QWidget>
 
+#include "../AttendanceExport.h"
+#include "../AttendanceStats.h"
+#include "../DrawEngine.h"
+#include "../GroupOptimizer.h"
+#include "../RosterSearch.h"
 #include "../Utils.h"
+#include "RollingNameView.h"
+#include "RosterListModel.h"
+
+#include <memory>
 
 class AttendanceSummaryWidget : public QWidget {
     Q_OBJECT
 public:
     explicit AttendanceSummaryWidget(QWidget* parent = nullptr);
     void resetDaily();
-    void applyAbsentees(const QStringList& absentees);
+    void applyAbsentees(const StudentSet& absentees);
     void setPinnedOnTop(bool onTop);
+    void refreshUi();
 
 protected:
     void closeEvent(QCloseEvent* event) override;
 
 private:
     QString m_lastResetDate;
-    QStringList m_absentees;
+    StudentSet m_absentees;
     QLabel* m_updateTime;
     QLabel* m_expectedLabel;
     QLabel* m_expectedValue;
@@ -46,29 +60,80 @@ private:
     QLabel* m_absentList;
 
     void syncDaily();
-    void refreshUi();
+};
+
+class AttendanceExportDialog : public QDialog {
+    Q_OBJECT
+public:
+    explicit AttendanceExportDialog(QWidget* parent = nullptr);
+    void openExport();
+
+protected:
+    void closeEvent(QCloseEvent* event) override;
+
+private:
+    QDateEdit* m_fromEdit;
+    QDateEdit* m_toEdit;
+    QComboBox* m_scopeCombo;
+    QComboBox* m_formatCombo;
+    QProgressBar* m_progress;
+    QLabel* m_statusLabel;
+    QPushButton* m_startButton;
+    QPushButton* m_cancelButton;
+    AttendanceExporter* m_exporter;
+
+    void startExport();
+    void setRunning(bool running);
 };
 
 class AttendanceSelectDialog : public QDialog {
     Q_OBJECT
 public:
     explicit AttendanceSelectDialog(QWidget* parent = nullptr);
-    void setSelectedAbsentees(const QStringList& absentees);
+    void setSelectedAbsentees(const StudentSet& absentees);
+    void reloadRoster();
 
 signals:
-    void saved(const QStringList& absentees);
+    void saved(const StudentSet& absentees);
+    void statsRequested();
 
 protected:
     void closeEvent(QCloseEvent* event) override;
 
 private:
-    QListWidget* m_roster;
+    QListView* m_rosterView;
+    RosterListModel* m_rosterModel;
     QLineEdit* m_searchEdit;
+    RosterPtr m_students;
+    std::unique_ptr<RosterSearchIndex> m_searchIndex;
+    AttendanceExportDialog* m_exportDialog = nullptr;
+    StudentSet checkedStudents() const;
     void saveSelection();
     void exportSelection();
     void filterRoster(const QString& keyword);
 };
 
+class AttendanceStatsDialog : public QDialog {
+    Q_OBJECT
+public:
+    explicit AttendanceStatsDialog(QWidget* parent = nullptr);
+    void reloadIfStale();
+    void applyToday(const StudentSet& absentees);
+
+protected:
+    void closeEvent(QCloseEvent* event) override;
+
+private:
+    QLabel* m_summaryLabel;
+    QLabel* m_weekdayLabel;
+    QTableWidget* m_table;
+    AttendanceMatrix m_matrix;
+    bool m_loaded = false;
+
+    void refreshTable();
+    void showAbsences(int row);
+};
+
 class RandomCallDialog : public QDialog {
     Q_OBJECT
 public:
@@ -79,23 +144,27 @@ protected:
     void closeEvent(QCloseEvent* event) override;
 
 private:
-    QLabel* m_nameLabel;
+    RollingNameView* m_nameView;
     QLabel* m_hintLabel;
     QLabel* m_historyLabel;
     QPushButton* m_toggleButton;
     QPushButton* m_copyButton;
+    QPushButton* m_awardButton;
     QPushButton* m_closeButton;
     QTimer* m_timer;
-    QStringList m_list;
-    QStringList m_remainingList;
+    RosterPtr m_roster;
+    DrawEngine m_engine;
+    QSpinBox* m_pickCount;
+    QVector<StudentId> m_picks;
     QStringList m_history;
+    QStringList m_awardKeys;
     int m_count = 0;
     bool m_running = false;
-    QDateTime m_rollStartAt;
-    QHash<QString, QDateTime> m_recentPickedAt;
+    QElapsedTimer m_rollClock;
 
     void toggleRolling();
-    QString drawName() const;
+    void refreshWeights();
+    QStringList pickedNames() const;
 };
 
 class ClassTimerDialog : public QDialog {
@@ -112,10 +181,14 @@ private:
     QSpinBox* m_minutesSpin;
     QPushButton* m_startPauseButton;
     QPushButton* m_resetButton;
-    QTimer* m_timer;
-    int m_remainingSeconds = 0;
+    quint64 m_tickTimer = 0;
+    QElapsedTimer m_runClock;
+    qint64 m_runFromMs = 0;
+    qint64 m_remainingMs = 0;
     bool m_running = false;
 
+    void tick();
+    void stopTicking();
     void updateCountdownText();
 };
 
@@ -139,6 +212,7 @@ class GroupSplitDialog : public QDialog {
     Q_OBJECT
 public:
     explicit GroupSplitDialog(QWidget* parent = nullptr);
+    ~GroupSplitDialog() override;
     void openSplitter();
 
 protected:
@@ -147,7 +221,20 @@ protected:
 private:
     QSpinBox* m_groupSize;
     QTextEdit* m_result;
+    QLabel* m_summary;
+    QPushButton* m_confirmBtn;
+    // 优化在工作线程进行，结束前不读写下面的状态。
+    QThread* m_worker = nullptr;
+    bool m_rerun = false;
+    RosterPtr m_roster;
+    QString m_classKey;
+    GroupProblem m_problem;
+    GroupPlan m_plan;
     void generate();
+    void finishGenerate();
+    void confirmGroups();
+    void awardGroup();
+    void editRules(bool together);
 };
 
 class ScoreBoardDialog : public QDialog {
@@ -163,9 +250,13 @@ private:
     QLabel* m_teamALabel;
     QLabel* m_teamBLabel;
     QLabel* m_scoreLabel;
+    QComboBox* m_boardRange;
+    QListWidget* m_leaderboard;
     int m_scoreA = 0;
     int m_scoreB = 0;
+    void awardTeam(bool teamA, int delta);
     void refreshScore();
+    void refreshLeaderboard();
 };
 
 class AIAssistantDialog : public QDialog {
@@ -208,7 +299,7 @@ private:
     QLabel* m_remainingLabel;
     QPushButton* m_shutdownButton;
     QPushButton* m_exitButton;
-    QTimer* m_tickTimer;
+    quint64 m_refreshTimer = 0;
     bool m_fromSelfStudy = false;
     QString m_cachedQuote;
     bool m_quoteRequested = false;
@@ -271,9 +362,6 @@ class SettingsDialog : public QDialog {
 public:
     explicit SettingsDialog(QWidget* parent = nullptr);
 
-signals:
-    void configChanged();
-
 protected:
     void closeEvent(QCloseEvent* event) override;
 
@@ -290,6 +378,7 @@ private:
     QCheckBox* m_showAttendanceSummaryOnStart;
 
     QCheckBox* m_randomNoRepeat;
+    QCheckBox* m_randomFairWeighted;
     QSpinBox* m_historyCount;
 
     QCheckBox* m_allowExternalLinks;